@@ -3,6 +3,7 @@ in vec2 vUV;
 out vec4 FragColor;
 
 uniform sampler2D ourTexture;
+uniform bool uPremultiplied; // cooked textures store color * alpha
 
 void main() {
     vec4 texColor = texture(ourTexture, vUV);
@@ -11,6 +12,11 @@ void main() {
     if (texColor.a < 0.1) {
         discard;
     }
+
+    // Filtered premultiplied texels have no dark fringes; undo it for straight-alpha blending
+    if (uPremultiplied) {
+        texColor.rgb /= texColor.a;
+    }
     
     FragColor = texColor;
 }
@@ -2,11 +2,19 @@
 layout (location = 0) in vec2 aPos;
 layout (location = 1) in vec2 aUV;
 
-uniform mat4 transform;   // proj * model
+// Shared per-frame camera data, written once per frame by the Renderer
+layout (std140) uniform Camera {
+    mat4 uView;
+    mat4 uProjection;
+    mat4 uViewProjection;
+    vec4 uViewportTime;   // xy = viewport size in pixels, z = time in seconds
+};
+
+uniform mat4 uModel;
 
 out vec2 vUV;
 
 void main() {
     vUV = aUV;
-    gl_Position = transform * vec4(aPos, 0.0, 1.0);
+    gl_Position = uViewProjection * uModel * vec4(aPos, 0.0, 1.0);
 }
@@ -0,0 +1,148 @@
+// Component lookup microbenchmark: the pre-ComponentTypes path (type_index map,
+// dynamic_cast fallback for base types) against the type-ID table GameObject
+// uses now. Build with -DKIAAK_BUILD_BENCHMARKS=ON and run ComponentLookupBench.
+#include "Core/Component.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+using namespace Kiaak::Core;
+
+namespace
+{
+    // Stand-ins shaped like a typical object: a transform, a few unrelated components
+    // and a collider behind an abstract base
+    class BenchTransform : public ComponentBase<BenchTransform>
+    {
+    public:
+        std::string GetTypeName() const override { return "BenchTransform"; }
+    };
+    class BenchSprite : public ComponentBase<BenchSprite>
+    {
+    public:
+        std::string GetTypeName() const override { return "BenchSprite"; }
+    };
+    class BenchBody : public ComponentBase<BenchBody>
+    {
+    public:
+        std::string GetTypeName() const override { return "BenchBody"; }
+    };
+    class BenchScript : public ComponentBase<BenchScript>
+    {
+    public:
+        std::string GetTypeName() const override { return "BenchScript"; }
+    };
+    class BenchCollider : public ComponentBase<BenchCollider>
+    {
+    };
+    class BenchBoxCollider : public ComponentBase<BenchBoxCollider, BenchCollider>
+    {
+    public:
+        std::string GetTypeName() const override { return "BenchBoxCollider"; }
+    };
+
+    // Lookup as GameObject did before: exact type through the map, bases by scanning
+    struct OldObject
+    {
+        std::vector<std::unique_ptr<Component>> components;
+        std::unordered_map<std::type_index, Component *> componentMap;
+
+        void Add(std::unique_ptr<Component> component)
+        {
+            componentMap[std::type_index(typeid(*component))] = component.get();
+            components.push_back(std::move(component));
+        }
+
+        template <typename T>
+        T *GetComponent()
+        {
+            auto it = componentMap.find(std::type_index(typeid(T)));
+            if (it != componentMap.end())
+                return static_cast<T *>(it->second);
+            for (auto &component : components)
+            {
+                if (auto *casted = dynamic_cast<T *>(component.get()))
+                    return casted;
+            }
+            return nullptr;
+        }
+    };
+
+    // Lookup as GameObject does now: one slot per type ID, filled along the lineage
+    struct NewObject
+    {
+        std::vector<std::unique_ptr<Component>> components;
+        std::vector<Component *> byType;
+
+        template <typename T>
+        void Add(std::unique_ptr<T> component)
+        {
+            for (ComponentTypeId id : ComponentTypes::Lineage(ComponentTypes::Id<T>()))
+            {
+                if (id >= byType.size())
+                    byType.resize(ComponentTypes::Count(), nullptr);
+                if (!byType[id])
+                    byType[id] = component.get();
+            }
+            components.push_back(std::move(component));
+        }
+
+        template <typename T>
+        T *GetComponent()
+        {
+            const ComponentTypeId id = ComponentTypes::Id<T>();
+            return id < byType.size() ? static_cast<T *>(byType[id]) : nullptr;
+        }
+    };
+
+    constexpr size_t kObjects = 1024;
+    constexpr size_t kLookups = 10000000;
+
+    template <typename Object>
+    void Populate(std::vector<Object> &objects)
+    {
+        objects.resize(kObjects);
+        for (Object &object : objects)
+        {
+            object.Add(std::make_unique<BenchTransform>());
+            object.Add(std::make_unique<BenchSprite>());
+            object.Add(std::make_unique<BenchBody>());
+            object.Add(std::make_unique<BenchScript>());
+            object.Add(std::make_unique<BenchBoxCollider>());
+        }
+    }
+
+    // Nanoseconds per lookup; the pointers are summed so the loop can't be dropped
+    template <typename T, typename Object>
+    double Measure(std::vector<Object> &objects, uintptr_t &sink)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kLookups; ++i)
+            sink += reinterpret_cast<uintptr_t>(objects[i % kObjects].template GetComponent<T>());
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / kLookups;
+    }
+}
+
+int main()
+{
+    std::vector<OldObject> oldObjects;
+    std::vector<NewObject> newObjects;
+    Populate(oldObjects);
+    Populate(newObjects);
+
+    uintptr_t sink = 0;
+    std::printf("%zu objects x 5 components, %zu lookups, ns per lookup\n", kObjects, kLookups);
+    std::printf("  %-36s %8s %8s\n", "", "before", "after");
+    std::printf("  %-36s %8.2f %8.2f\n", "GetComponent<BoxCollider> (exact)",
+                Measure<BenchBoxCollider>(oldObjects, sink), Measure<BenchBoxCollider>(newObjects, sink));
+    std::printf("  %-36s %8.2f %8.2f\n", "GetComponent<Collider> (base)",
+                Measure<BenchCollider>(oldObjects, sink), Measure<BenchCollider>(newObjects, sink));
+    std::printf("  %-36s %8.2f %8.2f\n", "GetComponent<Sprite> (exact)",
+                Measure<BenchSprite>(oldObjects, sink), Measure<BenchSprite>(newObjects, sink));
+    return sink == 0 ? 1 : 0;
+}
@@ -10,6 +10,7 @@
 #include <unordered_map>
 #include <memory>
 #include "Graphics/Texture.hpp"
+#include "Graphics/TextureCache.hpp"
 #include <fstream>
 #include <GLFW/glfw3.h>
 #include "Engine.hpp"
@@ -42,7 +43,6 @@ namespace Kiaak
     static int g_sheetEditorClipIndex = -1;                                          // which clip is being edited
     static std::vector<int> g_tempSelection;                                         // selection order while editing
     static std::map<Core::GameObject *, int> g_objectClipAssignments;                // mapping sprite object -> clip index
-    static std::unordered_map<std::string, std::shared_ptr<Texture>> g_textureCache; // editor preview cache
     static const char *kAnimationClipsFile = "animation_clips.json";                 // saved in working dir
     static const char *kAnimationAssignmentsFile = "animation_assignments.json";     // mapping objectID->clip index
     static std::unordered_map<uint32_t, int> g_pendingAssignments;                   // loaded IDs awaiting scene objects
@@ -503,33 +503,11 @@ namespace Kiaak
 
     static std::shared_ptr<Texture> GetOrLoadTexture(const std::string &path)
     {
-        if (path.empty())
+        // Same textures the scene uses; loaded synchronously when new so previews
+        // have their size right away. One the runtime is still streaming in shows next frame.
+        auto tex = TextureCache::Get(path, false);
+        if (!tex || !tex->EnsureResident()) // previews use the GL ID directly
             return nullptr;
-        // Resolve relative paths against project assets folder
-        std::string resolved = path;
-        if (!std::filesystem::exists(resolved))
-        {
-            if (Core::Project::HasPath())
-            {
-                auto tryPath = Core::Project::GetAssetsPath() + "/" + path;
-                if (std::filesystem::exists(tryPath))
-                    resolved = tryPath;
-            }
-            else
-            {
-                std::string tryPath = std::string("assets/") + path;
-                if (std::filesystem::exists(tryPath))
-                    resolved = tryPath;
-            }
-        }
-        auto cacheKey = resolved;
-        auto it = g_textureCache.find(cacheKey);
-        if (it != g_textureCache.end())
-            return it->second;
-        auto tex = std::make_shared<Texture>(resolved);
-        if (!tex->IsValid())
-            return nullptr;
-        g_textureCache[cacheKey] = tex;
         return tex;
     }
     int EditorUI::GetActiveTilemapPaintIndex() { return g_tilemapPaintIndex; }
@@ -1429,6 +1407,11 @@ namespace Kiaak
                     {
                         sprite->SetEnabled(enabled);
                     }
+                    bool isStatic = sprite->IsStatic();
+                    if (ImGui::Checkbox("Static##SpriteRenderer", &isStatic))
+                    {
+                        sprite->SetStatic(isStatic);
+                    }
                     ImGui::Text("Has texture: %s", sprite->GetTexture() ? "Yes" : "No");
                     if (!g_animationClips.empty())
                     {
@@ -1703,6 +1686,9 @@ namespace Kiaak
                 {
                     ImGui::Separator();
                     ImGui::Text("Tilemap");
+                    bool isStatic = tilemap->IsStatic();
+                    if (ImGui::Checkbox("Static (cached layer)##Tilemap", &isStatic))
+                        tilemap->SetStatic(isStatic);
                     int w = tilemap->GetWidth();
                     int h = tilemap->GetHeight();
                     float tw = tilemap->GetTileWidth();
@@ -7,13 +7,14 @@ namespace Kiaak
     namespace Core
     {
 
-        class Animator : public Component
+        class Animator : public ComponentBase<Animator>
         {
         public:
             Animator() = default;
             std::string GetTypeName() const override { return "Animator"; }
             void Start() override;
             void Update(double deltaTime) override;
+            uint32_t GetUpdatePhases() const override { return kPhaseUpdate; }
             void SetClipIndex(int idx)
             {
                 m_clipIndex = idx;
@@ -10,7 +10,7 @@ namespace Kiaak
     namespace Core
     {
 
-        class Camera : public Component
+        class Camera : public ComponentBase<Camera>
         {
         public:
             enum class ProjectionType
@@ -25,6 +25,7 @@ namespace Kiaak
             std::string GetTypeName() const override { return "Camera"; } // <-- fixed
             void Start() override;
             void Update(double deltaTime) override;
+            uint32_t GetUpdatePhases() const override { return kPhaseUpdate; }
 
             // ---- Camera API ----
             void SetActive();
@@ -43,7 +44,10 @@ namespace Kiaak
             const glm::mat4 &GetProjection() const;
             glm::mat4 GetViewProjection() const { return GetProjection() * GetView(); }
 
-            // Manually mark view dirty (used when camera's transform changes outside normal Update cycle)
+            // World-space XY rectangle covered by the view (AABB of the unprojected NDC corners)
+            void GetWorldBounds(glm::vec2 &outMin, glm::vec2 &outMax) const;
+
+            // Manually mark view dirty; transform changes are picked up on their own
             void InvalidateView() { m_viewDirty = true; }
 
             // ---- Follow target API ----
@@ -51,6 +55,8 @@ namespace Kiaak
             void SetFollowTargetByID(uint32_t id);
             uint32_t GetFollowTargetID() const { return m_followTargetID; }
             void ClearFollowTarget() { m_followTargetID = 0; }
+            // Target resolved through the owning scene; nullptr when none or when the handle is stale
+            GameObject *GetFollowTarget() const;
 
         private:
             void RecalculateView() const;
@@ -63,6 +69,7 @@ namespace Kiaak
             float m_orthographicSize{5.0f}; // Half-height of camera view in world units
 
             mutable bool m_viewDirty{true};
+            mutable uint32_t m_viewVersion{0}; // Transform::GetVersion() the view was built from
             mutable bool m_projDirty{true};
             mutable glm::mat4 m_view{1.0f};
             mutable glm::mat4 m_proj{1.0f};
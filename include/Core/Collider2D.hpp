@@ -14,7 +14,7 @@ namespace Kiaak
         class Transform;
 
         // Base 2D collider (axis-aligned). Derived shapes supply size.
-        class Collider2D : public Component
+        class Collider2D : public ComponentBase<Collider2D>
         {
         public:
             Collider2D() = default;
@@ -26,11 +26,25 @@ namespace Kiaak
             void SetTrigger(bool t) { m_isTrigger = t; }
             bool IsTrigger() const { return m_isTrigger; }
 
-            void SetOffset(const glm::vec2 &o) { m_offset = o; }
+            void SetOffset(const glm::vec2 &o)
+            {
+                m_offset = o;
+                InvalidateAABB();
+            }
             glm::vec2 GetOffset() const { return m_offset; }
 
+            // Off by default: the size is in world units and ignores the transform's scale and
+            // rotation. When set, the size is local and the AABB bounds the box under the
+            // world transform (used by tile colliders so they match the drawn tiles).
+            void SetUseWorldTransform(bool use)
+            {
+                m_useWorldTransform = use;
+                InvalidateAABB();
+            }
+            bool GetUseWorldTransform() const { return m_useWorldTransform; }
+
             glm::vec2 GetWorldCenter() const;                         // transform position + offset
-            void GetAABB(glm::vec2 &outMin, glm::vec2 &outMax) const; // world-space AABB
+            void GetAABB(glm::vec2 &outMin, glm::vec2 &outMax) const; // world-space AABB, cached until the transform or shape changes
 
             virtual glm::vec2 GetSize() const = 0; // width,height
             // Internal dispatch used by physics (routes to owner components)
@@ -42,19 +56,32 @@ namespace Kiaak
             void _DispatchTriggerExit(Collider2D *other);
 
         protected:
+            // Derived shapes call this when their size changes
+            void InvalidateAABB() { m_aabbVersion = 0; }
+
             bool m_isTrigger{false};
             glm::vec2 m_offset{0.0f};
             bool m_registered{false};
+            bool m_useWorldTransform{false};
+
+        private:
+            mutable glm::vec2 m_aabbMin{0.0f};
+            mutable glm::vec2 m_aabbMax{0.0f};
+            mutable uint32_t m_aabbVersion{0}; // Transform::GetVersion() of the cached AABB; 0 = none
         };
 
-        class BoxCollider2D : public Collider2D
+        class BoxCollider2D : public ComponentBase<BoxCollider2D, Collider2D>
         {
         public:
             BoxCollider2D() = default;
             ~BoxCollider2D() override = default;
             std::string GetTypeName() const override { return "BoxCollider2D"; }
             void Start() override; // auto-size from sprite if size==0
-            void SetSize(const glm::vec2 &s) { m_size = s; }
+            void SetSize(const glm::vec2 &s)
+            {
+                m_size = s;
+                InvalidateAABB();
+            }
             glm::vec2 GetSize() const override { return m_size; }
 
         private:
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "GameObject.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Kiaak
+{
+    namespace Core
+    {
+        class Scene; // fwd
+
+        /**
+         * Structural changes recorded while the scene is being iterated (Update,
+         * FixedUpdate, physics) and applied together at the sync points in Engine::Run.
+         * Targets are GameObject handles, so a command whose object was destroyed in
+         * the meantime is dropped. Destroys are applied after everything else, as one
+         * batch per playback.
+         */
+        class CommandBuffer
+        {
+        public:
+            using Setup = std::function<void(GameObject &)>;
+
+            // setup runs right after the object is created (and started, if the scene is)
+            void CreateGameObject(const std::string &name, Setup setup = nullptr);
+            void DestroyGameObject(uint32_t id);
+            // parentId 0 detaches from the current parent
+            void SetParent(uint32_t childId, uint32_t parentId);
+
+            template <typename T, typename... Args>
+            void AddComponent(uint32_t id, Args... args)
+            {
+                m_commands.push_back([id, args...](Scene &scene)
+                                     {
+                                         if (GameObject *go = Resolve(scene, id))
+                                             go->AddComponent<T>(args...); });
+            }
+
+            template <typename T>
+            void RemoveComponent(uint32_t id)
+            {
+                m_commands.push_back([id](Scene &scene)
+                                     {
+                                         if (GameObject *go = Resolve(scene, id))
+                                             go->RemoveComponent<T>(); });
+            }
+
+            bool IsEmpty() const { return m_commands.empty() && m_destroys.empty(); }
+            size_t GetCommandCount() const { return m_commands.size() + m_destroys.size(); }
+
+            // Applies commands in record order, then the destroys. Commands recorded while
+            // applying (e.g. by a new object's Start) are applied in the same call.
+            void Playback(Scene &scene);
+            void Clear();
+
+        private:
+            static GameObject *Resolve(Scene &scene, uint32_t id);
+
+            std::vector<std::function<void(Scene &)>> m_commands;
+            std::vector<uint32_t> m_destroys;
+        };
+
+    } // namespace Core
+} // namespace Kiaak
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ComponentType.hpp"
+#include <cstdint>
 #include <string>
 #include <typeinfo>
 #include <memory>
@@ -12,6 +14,15 @@ namespace Kiaak
         // Forward declaration
         class GameObject;
 
+        // Per-frame callbacks a component type takes part in (see Component::GetUpdatePhases)
+        enum UpdatePhaseFlags : uint32_t
+        {
+            kPhaseNone = 0,
+            kPhaseUpdate = 1u << 0,
+            kPhaseFixedUpdate = 1u << 1,
+        };
+        constexpr int kUpdatePhaseCount = 2;
+
         /**
          * Base class for all components in the game engine
          * Components define behavior and data that can be attached to GameObjects
@@ -19,6 +30,10 @@ namespace Kiaak
         class Component
         {
         public:
+            // Set by ComponentBase; ComponentTypes reads the base-class chain from them
+            using Super = Component;
+            using ComponentSelf = Component;
+
             Component() = default;
             virtual ~Component() = default;
 
@@ -28,6 +43,10 @@ namespace Kiaak
             virtual void FixedUpdate(double fixedDeltaTime) {}
             virtual void OnDestroy() {}
 
+            // Which of Update/FixedUpdate the scene should call. Only components listed in
+            // a phase are visited, so a type overriding Update must also return kPhaseUpdate.
+            virtual uint32_t GetUpdatePhases() const { return kPhaseNone; }
+
             // Collision / Trigger callbacks (default no-op)
             // other points to the other collider involved in the interaction.
             // For triggers, only trigger callbacks fire; for solid collisions only collision callbacks fire.
@@ -47,6 +66,8 @@ namespace Kiaak
 
             // Component type identification
             virtual std::string GetTypeName() const = 0;
+            // Concrete type, assigned when added to a GameObject
+            ComponentTypeId GetTypeId() const { return m_typeId; }
 
             // Template method to get type name for derived classes
             template <typename T>
@@ -59,7 +80,29 @@ namespace Kiaak
             bool m_enabled = true;
             GameObject *m_gameObject = nullptr;
 
+        private:
+            ComponentTypeId m_typeId = kInvalidComponentType;
+            uint32_t m_registryIndex = UINT32_MAX; // slot in the scene's ComponentRegistry
+            uint32_t m_phaseIndex[kUpdatePhaseCount] = {UINT32_MAX, UINT32_MAX}; // slots in its phase lists
+
             friend class GameObject; // Allow GameObject to set the gameObject reference
+            friend class ComponentRegistry;
+        };
+
+        /**
+         * Every concrete component derives through this, naming its direct component base:
+         *   class Camera : public ComponentBase<Camera> { ... };
+         *   class BoxCollider2D : public ComponentBase<BoxCollider2D, Collider2D> { ... };
+         * This gives the type its Super (used for GetComponent<Base>/View<Base>); deriving
+         * from a component class directly instead fails to compile on first use.
+         */
+        template <typename Derived, typename Base = Component>
+        class ComponentBase : public Base
+        {
+        public:
+            using Super = Base;
+            using ComponentSelf = Derived;
+            using Base::Base;
         };
 
     } // namespace Core
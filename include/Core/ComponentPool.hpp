@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Component.hpp"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Kiaak
+{
+    namespace Core
+    {
+
+        /**
+         * Fixed-size block allocator for one component type. Blocks come from chunks
+         * that grow geometrically and are recycled through a free list, so spawning
+         * thousands of objects reuses a few large allocations instead of one malloc per
+         * component, and components of a type sit next to each other in memory.
+         * Main thread only (components are created and destroyed there).
+         */
+        class ComponentPoolBase
+        {
+        public:
+            struct Stats
+            {
+                std::string typeName;
+                size_t live = 0;
+                size_t capacity = 0;
+                size_t blockSize = 0;
+                size_t chunks = 0;
+            };
+
+            void *Allocate();
+            void Free(void *block);
+            // Make room for at least count live components without further allocations
+            void Reserve(size_t count);
+
+            size_t GetLive() const { return m_live; }
+            size_t GetCapacity() const { return m_capacity; }
+            size_t GetBlockSize() const { return m_blockSize; }
+            const std::string &GetTypeName() const { return m_typeName; }
+            void SetTypeName(const std::string &name) { m_typeName = name; }
+
+            // Every pool that has been used, most live components first
+            static std::vector<Stats> GetAllStats();
+
+        protected:
+            ComponentPoolBase(size_t size, size_t alignment);
+            ~ComponentPoolBase();
+            ComponentPoolBase(const ComponentPoolBase &) = delete;
+            ComponentPoolBase &operator=(const ComponentPoolBase &) = delete;
+
+        private:
+            struct FreeBlock
+            {
+                FreeBlock *next;
+            };
+
+            void Grow(size_t blocks);
+            static std::vector<ComponentPoolBase *> &Registry();
+
+            size_t m_blockSize;
+            FreeBlock *m_free = nullptr;
+            std::vector<std::unique_ptr<unsigned char[]>> m_chunks;
+            size_t m_live = 0;
+            size_t m_capacity = 0;
+            std::string m_typeName;
+        };
+
+        template <typename T>
+        class ComponentPool : public ComponentPoolBase
+        {
+            static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "over-aligned components are not pooled");
+
+        public:
+            static ComponentPool &Get()
+            {
+                static ComponentPool pool;
+                return pool;
+            }
+
+        private:
+            ComponentPool() : ComponentPoolBase(sizeof(T), alignof(T)) {}
+        };
+
+        // Destroys a component and returns its block to the pool it came from
+        struct ComponentDeleter
+        {
+            ComponentPoolBase *pool = nullptr; // nullptr: allocated with plain new
+
+            void operator()(Component *component) const
+            {
+                if (!component)
+                    return;
+                if (!pool)
+                {
+                    delete component;
+                    return;
+                }
+                void *block = dynamic_cast<void *>(component); // most-derived address
+                component->~Component();
+                pool->Free(block);
+            }
+        };
+
+        using ComponentPtr = std::unique_ptr<Component, ComponentDeleter>;
+
+        template <typename T, typename... Args>
+        std::unique_ptr<T, ComponentDeleter> MakePooledComponent(Args &&...args)
+        {
+            auto &pool = ComponentPool<T>::Get();
+            void *block = pool.Allocate();
+            T *component = nullptr;
+            try
+            {
+                component = new (block) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                pool.Free(block);
+                throw;
+            }
+            if (pool.GetTypeName().empty())
+                pool.SetTypeName(component->GetTypeName());
+            return std::unique_ptr<T, ComponentDeleter>(component, ComponentDeleter{&pool});
+        }
+
+    } // namespace Core
+} // namespace Kiaak
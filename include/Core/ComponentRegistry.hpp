@@ -0,0 +1,190 @@
+#pragma once
+
+#include "Component.hpp"
+#include "ComponentType.hpp"
+#include "GameObject.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace Kiaak
+{
+    namespace Core
+    {
+
+        /**
+         * Per-scene index of every component by concrete type. Each type keeps a dense
+         * array of pointers in the order the components were added, so systems walk one
+         * contiguous array instead of visiting every GameObject and looking the
+         * component up. Components stay where GameObject allocated them (pointers held
+         * by scripts, the editor and physics remain valid); removal leaves a hole that
+         * is compacted away once no view is iterating.
+         * Components that declare an update phase are also listed per phase, so the
+         * scene's Update/FixedUpdate only visits components that do work there.
+         */
+        class ComponentRegistry
+        {
+        public:
+            class Set
+            {
+            public:
+                // Slots including holes (nullptr); iterate by index up to Size()
+                size_t Size() const { return m_dense.size(); }
+                Component *At(size_t i) const { return m_dense[i]; }
+                // Live components
+                size_t Count() const { return m_dense.size() - m_holes; }
+
+            private:
+                friend class ComponentRegistry;
+                std::vector<Component *> m_dense;
+                size_t m_holes = 0;
+                int m_phase = -1; // index into Component::m_phaseIndex, or -1 for a type set
+            };
+
+            ComponentRegistry();
+
+            void Add(Component *component);
+            void Remove(Component *component);
+
+            // nullptr if no component of exactly this type was ever added. Don't hold on
+            // to the pointer: registering a new type may move the sets.
+            const Set *Find(ComponentTypeId type) const { return type < m_sets.size() ? &m_sets[type] : nullptr; }
+
+            // Components whose type returns this phase from GetUpdatePhases(), in the order added
+            const Set &GetPhase(UpdatePhaseFlags phase) const { return m_phases[PhaseSlot(phase)]; }
+
+            // Drop holes from every set (skipped while a view is iterating)
+            void Compact();
+            void Clear();
+
+            // Views hold this while walking a set so removals don't move slots under them
+            class IterationScope
+            {
+            public:
+                explicit IterationScope(ComponentRegistry &registry) : m_registry(registry) { m_registry.m_iterating++; }
+                ~IterationScope();
+                IterationScope(const IterationScope &) = delete;
+                IterationScope &operator=(const IterationScope &) = delete;
+
+            private:
+                ComponentRegistry &m_registry;
+            };
+
+        private:
+            static int PhaseSlot(UpdatePhaseFlags phase) { return phase == kPhaseFixedUpdate ? 1 : 0; }
+            static uint32_t &IndexIn(Component *component, const Set &set);
+            void AddTo(Set &set, Component *component);
+            void RemoveFrom(Set &set, Component *component);
+            void CompactSet(Set &set);
+
+            std::vector<Set> m_sets; // indexed by concrete ComponentTypeId
+            Set m_phases[kUpdatePhaseCount];
+            int m_iterating = 0;
+            bool m_compactPending = false;
+        };
+
+        /**
+         * Iterates every T, including components deriving from it, whose GameObject also
+         * has all of Others:
+         *   for (Tilemap *tilemap : scene->View<Tilemap>()) { ... }
+         *   scene->View<SpriteRenderer, Animator>().Each([](SpriteRenderer &sr, Animator &anim) { ... });
+         * Types are visited one concrete set after another (View<Collider2D> walks the
+         * BoxCollider2D set, then any other collider's). Components added during
+         * iteration are visited; removed ones are skipped. Inactive GameObjects and
+         * disabled components are not filtered out.
+         */
+        template <typename T, typename... Others>
+        class ComponentView
+        {
+        public:
+            explicit ComponentView(ComponentRegistry &registry)
+                : m_scope(registry), m_registry(&registry), m_types(&ComponentTypes::Derived(ComponentTypes::Id<T>())) {}
+
+            class Iterator
+            {
+            public:
+                Iterator(const ComponentView *view, size_t type) : m_view(view), m_type(type) { Skip(); }
+                T *operator*() const { return static_cast<T *>(CurrentSet()->At(m_index)); }
+                Iterator &operator++()
+                {
+                    ++m_index;
+                    Skip();
+                    return *this;
+                }
+                // Sets may grow while iterating, so the end is re-checked every step
+                bool operator!=(const Iterator &) const { return m_view && m_type < m_view->m_types->size(); }
+
+            private:
+                // Looked up per step: a type registered mid-loop can reallocate the sets
+                const ComponentRegistry::Set *CurrentSet() const { return m_view->m_registry->Find((*m_view->m_types)[m_type]); }
+
+                void Skip()
+                {
+                    while (m_view && m_type < m_view->m_types->size())
+                    {
+                        const ComponentRegistry::Set *set = CurrentSet();
+                        if (set && m_index < set->Size())
+                        {
+                            if (Matches(set->At(m_index)))
+                                return;
+                            ++m_index;
+                        }
+                        else
+                        {
+                            ++m_type;
+                            m_index = 0;
+                        }
+                    }
+                }
+
+                const ComponentView *m_view;
+                size_t m_type;
+                size_t m_index = 0;
+            };
+
+            Iterator begin() const { return Iterator(this, 0); }
+            Iterator end() const { return Iterator(nullptr, 0); }
+
+            template <typename Fn>
+            void Each(Fn &&fn) const
+            {
+                for (T *primary : *this)
+                {
+                    if constexpr (sizeof...(Others) == 0)
+                        fn(*primary);
+                    else
+                        fn(*primary, *primary->GetGameObject()->template GetComponent<Others>()...);
+                }
+            }
+
+            // Live components of the primary type (an upper bound when Others is non-empty)
+            size_t SizeHint() const
+            {
+                size_t count = 0;
+                for (ComponentTypeId type : *m_types)
+                    if (const auto *set = m_registry->Find(type))
+                        count += set->Count();
+                return count;
+            }
+
+        private:
+            static bool Matches(Component *component)
+            {
+                if (!component)
+                    return false;
+                if constexpr (sizeof...(Others) == 0)
+                    return true;
+                else
+                {
+                    GameObject *go = component->GetGameObject();
+                    return ((go->template HasComponent<Others>()) && ...);
+                }
+            }
+
+            // Held for the view's lifetime so removals don't move slots under an iterator
+            ComponentRegistry::IterationScope m_scope;
+            const ComponentRegistry *m_registry;
+            const std::vector<ComponentTypeId> *m_types; // T and every type deriving from it
+        };
+
+    } // namespace Core
+} // namespace Kiaak
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <type_traits>
+#include <vector>
+
+namespace Kiaak
+{
+    namespace Core
+    {
+        class Component; // fwd
+
+        using ComponentTypeId = uint16_t;
+        constexpr ComponentTypeId kInvalidComponentType = UINT16_MAX;
+
+        /**
+         * Dense IDs for component types, handed out the first time a type is used.
+         * Each type also records its component base classes (through the Super alias
+         * that ComponentBase<T, Base> declares), so "is a Collider2D" is a lookup
+         * instead of a dynamic_cast.
+         * Main thread only, like the rest of the component model.
+         */
+        class ComponentTypes
+        {
+        public:
+            template <typename T>
+            static ComponentTypeId Id()
+            {
+                static_assert(std::is_base_of_v<Component, T>, "T must be derived from Component");
+                // A class deriving from another component without ComponentBase would inherit its
+                // parent's Super and be missing from GetComponent/View of that parent
+                static_assert(std::is_same_v<typename T::ComponentSelf, T>,
+                              "Components must derive through ComponentBase<T, DirectBase>");
+                static const ComponentTypeId id = Register(SuperId<T>());
+                return id;
+            }
+
+            // The type followed by each of its component bases, most derived first
+            static const std::vector<ComponentTypeId> &Lineage(ComponentTypeId id) { return Info(id).lineage; }
+            // The type and every registered type deriving from it; grows as types register
+            static const std::vector<ComponentTypeId> &Derived(ComponentTypeId id) { return Info(id).derived; }
+            static bool IsA(ComponentTypeId type, ComponentTypeId base);
+            static size_t Count();
+
+        private:
+            struct TypeInfo
+            {
+                std::vector<ComponentTypeId> lineage;
+                std::vector<ComponentTypeId> derived;
+            };
+
+            template <typename T>
+            static ComponentTypeId SuperId()
+            {
+                using Super = typename T::Super;
+                static_assert(std::is_base_of_v<Super, T>, "Super must be a base class of the component");
+                if constexpr (std::is_same_v<Super, Component> || std::is_same_v<Super, T>)
+                    return kInvalidComponentType;
+                else
+                    return Id<Super>();
+            }
+
+            static ComponentTypeId Register(ComponentTypeId super);
+            static TypeInfo &Info(ComponentTypeId id) { return Types()[id]; }
+            // deque: references handed out by Lineage()/Derived() stay valid as types register
+            static std::deque<TypeInfo> &Types();
+        };
+
+    } // namespace Core
+} // namespace Kiaak
@@ -1,13 +1,11 @@
 #pragma once
 
 #include "Component.hpp"
+#include "ComponentPool.hpp"
 #include "Transform.hpp"
 #include <string>
 #include <vector>
 #include <memory>
-#include <unordered_map>
-#include <typeinfo>
-#include <typeindex>
 
 namespace Kiaak
 {
@@ -29,8 +27,9 @@ namespace Kiaak
             void SetName(const std::string &name) { m_name = name; }
             const std::string &GetName() const { return m_name; }
 
-            // Simple hierarchy (editor organization only; does NOT affect transform math)
-            void SetParent(GameObject *newParent);
+            // Hierarchy: a child's Transform is relative to its parent's. By default the
+            // child keeps its world position/rotation/scale across a reparent.
+            void SetParent(GameObject *newParent, bool keepWorldTransform = true);
             GameObject *GetParent() const { return m_parent; }
             const std::vector<GameObject *> &GetChildren() const { return m_children; }
             void AddChild(GameObject *child);
@@ -43,9 +42,9 @@ namespace Kiaak
             Transform *GetTransform() { return m_transform; }
             const Transform *GetTransform() const { return m_transform; }
 
-            // Owning Scene
+            // Owning Scene (components are indexed in its ComponentRegistry)
             Scene *GetScene() const { return m_scene; }
-            void SetScene(Scene *sc) { m_scene = sc; }
+            void SetScene(Scene *sc);
 
             // Component management
             template <typename T, typename... Args>
@@ -60,6 +59,7 @@ namespace Kiaak
             template <typename T>
             std::vector<T *> GetComponents();
 
+            // True for T itself or any component deriving from T (e.g. Collider2D)
             template <typename T>
             bool HasComponent() const;
 
@@ -79,13 +79,15 @@ namespace Kiaak
             void FixedUpdate(double fixedDeltaTime);
             void OnDestroy();
 
-            // Unique ID for this GameObject
+            // Generational handle assigned by the owning Scene (0 until then); see Scene::IsAlive
             uint32_t GetID() const { return m_id; }
 
         private:
+            friend class Scene; // assigns m_id from its slot map
+
             std::string m_name;
             bool m_active = true;
-            uint32_t m_id;
+            uint32_t m_id = 0;
             bool m_started = false; // whether Start() has been invoked
 
             // Hierarchy
@@ -98,15 +100,20 @@ namespace Kiaak
             // Back-pointer to owning scene (non-owning)
             Scene *m_scene = nullptr;
 
-            // Component storage
-            std::vector<std::unique_ptr<Component>> m_components;
-            std::unordered_map<std::type_index, Component *> m_componentMap;
-
-            // Static ID counter
-            static uint32_t s_nextID;
+            // Component storage (blocks from the per-type ComponentPool)
+            std::vector<ComponentPtr> m_components;
+            // Indexed by ComponentTypeId: the first component that is (or derives from) that type
+            std::vector<Component *> m_byType;
 
             // Helper methods
-            void AddComponentInternal(std::unique_ptr<Component> component);
+            void AddComponentInternal(ComponentPtr component);
+            void RemoveComponentInternal(Component *component);
+            void RegisterComponents(bool add);
+            void IndexComponent(Component *component);
+            Component *FindByType(ComponentTypeId id) const
+            {
+                return id < m_byType.size() ? m_byType[id] : nullptr;
+            }
         };
 
         // Template implementations
@@ -124,8 +131,9 @@ namespace Kiaak
                 }
             }
 
-            auto component = std::make_unique<T>(std::forward<Args>(args)...);
+            auto component = MakePooledComponent<T>(std::forward<Args>(args)...);
             T *componentPtr = component.get();
+            componentPtr->m_typeId = ComponentTypes::Id<T>();
 
             AddComponentInternal(std::move(component));
             // If this GameObject has already started, immediately start the new component
@@ -139,45 +147,25 @@ namespace Kiaak
         template <typename T>
         T *GameObject::GetComponent()
         {
-            auto it = m_componentMap.find(std::type_index(typeid(T)));
-            if (it != m_componentMap.end())
-            {
-                return static_cast<T *>(it->second);
-            }
-            // Fallback: allow querying by base class (e.g., Collider2D when only BoxCollider2D stored)
-            for (auto &component : m_components)
-            {
-                if (auto *casted = dynamic_cast<T *>(component.get()))
-                    return casted;
-            }
-            return nullptr;
+            return static_cast<T *>(FindByType(ComponentTypes::Id<T>()));
         }
 
         template <typename T>
         const T *GameObject::GetComponent() const
         {
-            auto it = m_componentMap.find(std::type_index(typeid(T)));
-            if (it != m_componentMap.end())
-            {
-                return static_cast<const T *>(it->second);
-            }
-            for (auto &component : m_components)
-            {
-                if (auto *casted = dynamic_cast<const T *>(component.get()))
-                    return casted;
-            }
-            return nullptr;
+            return static_cast<const T *>(FindByType(ComponentTypes::Id<T>()));
         }
 
         template <typename T>
         std::vector<T *> GameObject::GetComponents()
         {
             std::vector<T *> result;
+            const ComponentTypeId id = ComponentTypes::Id<T>();
             for (auto &component : m_components)
             {
-                if (T *casted = dynamic_cast<T *>(component.get()))
+                if (ComponentTypes::IsA(component->m_typeId, id))
                 {
-                    result.push_back(casted);
+                    result.push_back(static_cast<T *>(component.get()));
                 }
             }
             return result;
@@ -186,35 +174,22 @@ namespace Kiaak
         template <typename T>
         bool GameObject::HasComponent() const
         {
-            return m_componentMap.find(std::type_index(typeid(T))) != m_componentMap.end();
+            return FindByType(ComponentTypes::Id<T>()) != nullptr;
         }
 
         template <typename T>
         bool GameObject::RemoveComponent()
         {
-            auto it = m_componentMap.find(std::type_index(typeid(T)));
-            if (it != m_componentMap.end())
+            Component *component = FindByType(ComponentTypes::Id<T>());
+            if (component)
             {
-                Component *component = it->second;
-
                 // Don't allow removing Transform
                 if (component == m_transform)
                 {
                     return false;
                 }
 
-                // Remove from map
-                m_componentMap.erase(it);
-
-                // Remove from vector
-                m_components.erase(
-                    std::remove_if(m_components.begin(), m_components.end(),
-                                   [component](const std::unique_ptr<Component> &ptr)
-                                   {
-                                       return ptr.get() == component;
-                                   }),
-                    m_components.end());
-
+                RemoveComponentInternal(component);
                 return true;
             }
             return false;
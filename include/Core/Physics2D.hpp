@@ -46,6 +46,11 @@ namespace Kiaak
             void RegisterCollider(Collider2D *col);
             void UnregisterCollider(Collider2D *col);
 
+            // Debug visualization of the last step's contacts (points + normals)
+            static void SetDebugDrawEnabled(bool enabled) { s_debugDraw = enabled; }
+            static bool IsDebugDrawEnabled() { return s_debugDraw; }
+            void DrawDebug() const;
+
         private:
             struct BodyRec
             {
@@ -72,6 +77,7 @@ namespace Kiaak
             std::vector<ColliderRec> m_colliders;
             std::unordered_set<PairKey, PairKeyHasher> m_prevFramePairs;
             std::vector<Contact> m_contacts;
+            static bool s_debugDraw;
 
         public:
             const std::vector<ColliderRec> &GetColliders() const { return m_colliders; }
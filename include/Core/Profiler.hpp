@@ -0,0 +1,119 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace Kiaak
+{
+
+    // Frame profiler: CPU scopes on the high-resolution clock and GPU stage
+    // timings from GL_TIME_ELAPSED queries. GPU results are read back a few
+    // frames late (kGpuLatency) so collecting them never stalls the pipeline.
+    // Every timing keeps a rolling history of kHistorySize frames in ms.
+    class Profiler
+    {
+    public:
+        enum class CpuStage
+        {
+            Input,
+            FixedUpdate,
+            Update,
+            Render,
+            Count
+        };
+
+        // Sprites and tilemaps share one z-sorted queue, so they are timed together as Scene
+        enum class GpuStage
+        {
+            Clear,
+            Scene,
+            DebugDraw,
+            ImGui,
+            Count
+        };
+
+        static constexpr int kHistorySize = 240;
+        static constexpr int kGpuLatency = 4;
+
+        // Rolling window of samples; Values() is in chronological order
+        class History
+        {
+        public:
+            void Push(float ms);
+            float Last() const;
+            float Average() const;
+            float Percentile(float p) const; // p in [0, 1]
+            const std::vector<float> &Values() const;
+            int Count() const { return m_count; }
+
+        private:
+            float m_samples[kHistorySize] = {};
+            int m_head = 0;
+            int m_count = 0;
+            mutable std::vector<float> m_ordered;
+        };
+
+        // CPU: bracket a whole loop iteration, then the stages inside it
+        static void BeginFrame();
+        static void EndFrame();
+        static void BeginCpu(CpuStage stage);
+        static void EndCpu(CpuStage stage);
+
+        // GPU: stages must not overlap (GL allows one GL_TIME_ELAPSED query at a time)
+        static void BeginGpu(GpuStage stage);
+        static void EndGpu(GpuStage stage);
+
+        struct CpuScope
+        {
+            explicit CpuScope(CpuStage s) : stage(s) { BeginCpu(stage); }
+            ~CpuScope() { EndCpu(stage); }
+            CpuStage stage;
+        };
+
+        static const History &GetCpuFrame() { return s_cpuFrame; }
+        static const History &GetCpu(CpuStage stage) { return s_cpu[static_cast<int>(stage)]; }
+        static const History &GetGpuFrame() { return s_gpuFrame; }
+        static const History &GetGpu(GpuStage stage) { return s_gpu[static_cast<int>(stage)]; }
+        static bool HasGpuTimings() { return s_gpuFrame.Count() > 0; }
+
+        static const char *GetName(CpuStage stage);
+        static const char *GetName(GpuStage stage);
+
+        static void SetOverlayVisible(bool visible) { s_overlayVisible = visible; }
+        static bool IsOverlayVisible() { return s_overlayVisible; }
+        static void ToggleOverlay() { s_overlayVisible = !s_overlayVisible; }
+
+        // Release GL query objects (Renderer shutdown)
+        static void Shutdown();
+
+    private:
+        using Clock = std::chrono::high_resolution_clock;
+
+        struct GpuSlot
+        {
+            unsigned int queries[static_cast<int>(GpuStage::Count)] = {};
+            bool issued[static_cast<int>(GpuStage::Count)] = {};
+            bool pending = false;
+        };
+
+        static bool EnsureQueries();
+        static void CollectGpu();
+
+        static Clock::time_point s_frameStart;
+        static Clock::time_point s_cpuStart[static_cast<int>(CpuStage::Count)];
+        static History s_cpuFrame;
+        static History s_cpu[static_cast<int>(CpuStage::Count)];
+        static float s_cpuAccum[static_cast<int>(CpuStage::Count)];
+
+        static GpuSlot s_gpuSlots[kGpuLatency];
+        static int s_gpuSlot;
+        static bool s_gpuReady;
+        static bool s_gpuActive;
+        static History s_gpuFrame;
+        static History s_gpu[static_cast<int>(GpuStage::Count)];
+
+        static bool s_overlayVisible;
+    };
+
+} // namespace Kiaak
@@ -10,7 +10,7 @@ namespace Kiaak
 
         class Physics2D;
 
-        class Rigidbody2D : public Component
+        class Rigidbody2D : public ComponentBase<Rigidbody2D>
         {
         public:
             enum class BodyType
@@ -25,7 +25,6 @@ namespace Kiaak
 
             // Component
             void Start() override;
-            void FixedUpdate(double dt) override;
             void OnDestroy() override;
             std::string GetTypeName() const override { return "Rigidbody2D"; }
 
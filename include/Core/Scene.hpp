@@ -1,8 +1,15 @@
 #pragma once
 
 #include "GameObject.hpp"
+#include "ComponentRegistry.hpp"
+#include "CommandBuffer.hpp"
 #include "Physics2D.hpp"
+#include "SpatialIndex.hpp"
+#include "Graphics/RenderQueue.hpp"
+#include "Graphics/StaticLayer.hpp"
 #include <utility>
+#include <deque>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -10,10 +17,16 @@
 
 namespace Kiaak
 {
+    namespace Graphics
+    {
+        class SpriteRenderer;
+    }
+
     namespace Core
     {
 
         class Camera; // forward declare
+        class Tilemap;
 
         class Scene
         {
@@ -29,12 +42,35 @@ namespace Kiaak
             bool RemoveGameObject(uint32_t id);
             bool RemoveGameObject(GameObject *gameObject);
             void ClearAllGameObjects();
+            // Removes a batch at once: bookkeeping for all of them first, then destruction,
+            // and a single compaction. Stale or duplicate handles are ignored.
+            size_t RemoveGameObjects(const std::vector<uint32_t> &ids);
+
+            // Structural changes recorded during Update/FixedUpdate and applied by
+            // ApplyCommands() at the sync points in Engine::Run
+            CommandBuffer &GetCommands() { return m_commands; }
+            void ApplyCommands() { m_commands.Playback(*this); }
+
+            // GameObject IDs are generational handles into this scene's slot map: the low
+            // bits pick the slot, the high bits count how often the slot was reused. Once
+            // an object is removed its handle never resolves again (0 is never a handle).
+            static constexpr uint32_t kHandleIndexBits = 20;
+            static constexpr uint32_t kHandleIndexMask = (1u << kHandleIndexBits) - 1;
+            static constexpr uint32_t kHandleMaxGeneration = (1u << (32 - kHandleIndexBits)) - 1;
+            // False for 0 and for handles whose object has been removed
+            bool IsAlive(uint32_t id) const { return Resolve(id) != nullptr; }
 
             // GameObject queries
             std::vector<GameObject *> GetAllGameObjects();
             std::vector<GameObject *> GetGameObjectsWithName(const std::string &name);
             size_t GetGameObjectCount() const;
 
+            // Component queries by concrete type, walking one dense array per type
+            // instead of every GameObject (see ComponentView)
+            template <typename T, typename... Others>
+            ComponentView<T, Others...> View() { return ComponentView<T, Others...>(m_componentRegistry); }
+            ComponentRegistry &GetComponentRegistry() { return m_componentRegistry; }
+
             // Scene lifecycle
             void Start();
             void Update(double deltaTime);
@@ -43,6 +79,42 @@ namespace Kiaak
             // components that are disabled are still drawn for authoring visibility.
             void Render(bool includeDisabledForEditor = false);
 
+            // Transforms whose world matrix changed since the previous Render(), each listed
+            // once; entries are nullptr where the object has been removed since. Render()
+            // brings them all up to date first and starts a new list when it is done.
+            const std::vector<Transform *> &GetChangedTransforms() const { return m_changedTransforms; }
+            // Rebuilds the world matrices of the changed transforms only (world matrices
+            // read earlier are computed on demand)
+            void UpdateTransforms();
+            // Called by Transform when its world matrix goes stale
+            void OnTransformChanged(Transform *transform);
+
+            // Objects whose world bounds (sprite quad, tilemap area) overlap the rectangle
+            // or circle, inactive ones included, in no particular order. Backed by a loose
+            // quadtree that is refreshed only for what moved or changed shape.
+            void FindObjectsInRect(const glm::vec2 &min, const glm::vec2 &max, std::vector<GameObject *> &out);
+            void FindObjectsInRadius(const glm::vec2 &center, float radius, std::vector<GameObject *> &out);
+            // Bounds changed without a transform change (size, texture, components)
+            void InvalidateBounds(GameObject *gameObject);
+
+            // Per-frame results of camera culling in Render()
+            struct CullingStats
+            {
+                uint32_t spritesVisible = 0;
+                uint32_t spritesCulled = 0;
+                uint32_t chunksVisible = 0;
+                uint32_t chunksCulled = 0;
+                uint32_t staticLayers = 0;  // cached layers composited this frame
+                uint32_t staticRedraws = 0; // cache regions re-rendered this frame
+            };
+            const CullingStats &GetCullingStats() const { return m_cullingStats; }
+
+            // Static tilemaps/sprites are rendered once into cached layers (one per z)
+            // and redrawn only where the view scrolls or their content changes
+            void SetStaticLayersEnabled(bool enabled);
+            bool AreStaticLayersEnabled() const { return m_staticLayersEnabled; }
+            void InvalidateStaticLayers();
+
             // Scene camera designation (used when entering play mode)
             void SetDesignatedCamera(Camera *cam) { m_designatedCamera = cam; }
             Camera *GetDesignatedCamera() const { return m_designatedCamera; }
@@ -53,10 +125,33 @@ namespace Kiaak
             Physics2D* GetPhysics2D() { return &m_physics2D; }
 
         private:
-            // GameObject storage
-            std::vector<std::unique_ptr<GameObject>> m_gameObjects;
+            // Declared before the GameObjects so it outlives them (they unregister on destruction)
+            ComponentRegistry m_componentRegistry;
+
+            // GameObject storage: slots own the objects and never move them; a removed
+            // object's slot is recycled with a bumped generation
+            struct Slot
+            {
+                std::unique_ptr<GameObject> object;
+                uint32_t generation = 1;
+                uint32_t orderIndex = 0; // position in m_order while occupied
+            };
+            std::vector<Slot> m_slots;
+            std::deque<uint32_t> m_freeSlots; // FIFO so each slot's generation advances slowly
+            // Creation order for iteration; removal leaves a nullptr hole so nothing shifts
+            std::vector<GameObject *> m_order;
+            size_t m_orderHoles = 0;
+            int m_iterating = 0; // holes are only compacted when no loop is walking m_order
             std::unordered_map<std::string, GameObject *> m_gameObjectsByName;
-            std::unordered_map<uint32_t, GameObject *> m_gameObjectsById;
+
+            CommandBuffer m_commands;
+
+            std::vector<Transform *> m_changedTransforms;
+
+            // World bounds of everything with a sprite or tilemap, keyed by handle; each entry
+            // keeps the transform version it was computed from
+            SpatialIndex m_spatialIndex;
+            std::vector<uint32_t> m_boundsDirty;
 
             // Scene state
             bool m_started = false;
@@ -67,7 +162,31 @@ namespace Kiaak
             // Physics world (2D)
             Physics2D m_physics2D;
 
+            CullingStats m_cullingStats;
+
+            // Reused every frame by Render()
+            Graphics::RenderQueue m_renderQueue;
+
+            struct StaticBatch
+            {
+                std::unique_ptr<Graphics::StaticLayer> layer;
+                std::vector<Tilemap *> tilemaps;
+                std::vector<Graphics::SpriteRenderer *> sprites;
+                uint64_t hash = 0; // everything that affects the cached pixels
+            };
+            std::map<float, StaticBatch> m_staticBatches; // keyed by z
+            bool m_staticLayersEnabled = true;
+
             // Helper methods
+            GameObject *Resolve(uint32_t id) const;
+            // Unlinks a live object from slots, order, names and hierarchy; the caller destroys it
+            std::unique_ptr<GameObject> Detach(GameObject *gameObject);
+            void CompactOrder();
+            void ClearTransformChanges();
+            void RefreshSpatialIndex();
+            void RefreshBounds(GameObject *gameObject, bool force);
+            // False if the object has nothing to index
+            bool ComputeBounds(GameObject *gameObject, glm::vec2 &min, glm::vec2 &max) const;
             std::string GenerateUniqueGameObjectName(const std::string &baseName) const;
         };
 
@@ -7,7 +7,7 @@
 namespace Kiaak::Core
 {
 
-    class ScriptComponent : public Component
+    class ScriptComponent : public ComponentBase<ScriptComponent>
     {
     public:
         ScriptComponent() = default;
@@ -21,6 +21,7 @@ namespace Kiaak::Core
 
         void Start() override;
         void Update(double) override;
+        uint32_t GetUpdatePhases() const override { return kPhaseUpdate; }
 
     private:
         sol::protected_function m_updateFunc;
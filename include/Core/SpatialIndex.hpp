@@ -0,0 +1,75 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Kiaak
+{
+    namespace Core
+    {
+
+        /**
+         * Loose quadtree over axis-aligned boxes keyed by a 32-bit ID (Scene uses
+         * GameObject handles). A box lives in the deepest node at least as large as
+         * the box that contains its center; nodes are queried with twice their size,
+         * so a box never straddles nodes and moving it is a remove + insert along
+         * two root paths. The root grows outwards when something lands outside it.
+         * Queries skip empty subtrees: O(log n + k) for well-spread boxes.
+         */
+        class SpatialIndex
+        {
+        public:
+            // Inserts the entry or moves it to its new bounds
+            void Update(uint32_t id, const glm::vec2 &min, const glm::vec2 &max, uint32_t stamp = 0);
+            void Remove(uint32_t id);
+            void Clear();
+
+            bool Contains(uint32_t id) const { return m_items.count(id) != 0; }
+            // Owner-defined value kept with the entry (e.g. the version the bounds came from); 0 when absent
+            uint32_t GetStamp(uint32_t id) const;
+            size_t Size() const { return m_items.size(); }
+
+            // Appends the IDs whose box overlaps the rectangle / circle (unordered)
+            void QueryRect(const glm::vec2 &min, const glm::vec2 &max, std::vector<uint32_t> &out) const;
+            void QueryRadius(const glm::vec2 &center, float radius, std::vector<uint32_t> &out) const;
+
+        private:
+            struct Entry
+            {
+                glm::vec2 min;
+                glm::vec2 max;
+                uint32_t id;
+            };
+            struct Node
+            {
+                glm::vec2 center;
+                float halfSize;
+                int32_t parent = -1;
+                int32_t children[4] = {-1, -1, -1, -1};
+                uint32_t count = 0; // entries in this subtree
+                std::vector<Entry> entries;
+            };
+            struct Item
+            {
+                int32_t node;
+                uint32_t slot; // index in the node's entries
+                uint32_t stamp;
+            };
+
+            void GrowRoot(const glm::vec2 &center, float halfExtent);
+            // Deepest node for the box; created on the way down when create is set, else -1 if missing
+            int32_t FindNode(const glm::vec2 &center, float halfExtent, bool create);
+            void Insert(uint32_t id, const glm::vec2 &min, const glm::vec2 &max, uint32_t stamp);
+            template <typename Overlaps>
+            void Query(const glm::vec2 &min, const glm::vec2 &max, const Overlaps &overlaps, std::vector<uint32_t> &out) const;
+
+            std::vector<Node> m_nodes;
+            int32_t m_root = -1;
+            std::unordered_map<uint32_t, Item> m_items;
+        };
+
+    } // namespace Core
+} // namespace Kiaak
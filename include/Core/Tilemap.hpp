@@ -11,13 +11,28 @@
 
 namespace Kiaak::Core
 {
-    class Tilemap : public Component
+    class Tilemap : public ComponentBase<Tilemap>
     {
     public:
         Tilemap();
         std::string GetTypeName() const override { return "Tilemap"; }
         void Start() override;
         void Render();
+        // Draw only the chunks overlapping the given world-space rectangle
+        void Render(const glm::vec2 &viewMin, const glm::vec2 &viewMax);
+        // Inclusive chunk range overlapping a world rectangle; false when nothing overlaps
+        bool GetVisibleChunkRange(const glm::vec2 &viewMin, const glm::vec2 &viewMax, int &cx0, int &cy0, int &cx1, int &cy1) const;
+        int GetChunkCount() const { return m_chunksX * m_chunksY; }
+        // Tiles are laid out from the local origin towards +x/+y and follow the full world
+        // transform (rotation and scale included, as do the tile colliders)
+        glm::vec2 LocalToWorld(const glm::vec2 &local) const;
+        glm::vec2 WorldToLocal(const glm::vec2 &world) const;
+        // Tile under a world point; false outside the map
+        bool WorldToTile(const glm::vec2 &world, int &tx, int &ty) const;
+        // World-space box around the whole map
+        void GetWorldBounds(glm::vec2 &outMin, glm::vec2 &outMax) const;
+        Texture *GetTexture() const { return m_texture.get(); }
+        static Kiaak::Shader *GetSharedShader() { return s_shader.get(); }
         void RebuildColliders(); // create per-tile collider GameObjects for frames flagged solid
         void SetMapSize(int w, int h);
         void SetTileSize(float w, float h);
@@ -37,6 +52,17 @@ namespace Kiaak::Core
         int GetTile(int x, int y) const;
         void SetTileColliderFlag(int frameIndex, bool solid);
         bool GetTileColliderFlag(int frameIndex) const;
+        // Call after writing through GetTiles() directly so chunk meshes are rebuilt
+        void MarkAllChunksDirty();
+        // Bumped on every change that affects what the tilemap draws
+        uint32_t GetRevision() const { return m_revision; }
+
+        // Static tilemaps are drawn through the scene's cached static layers
+        void SetStatic(bool isStatic) { m_static = isStatic; }
+        bool IsStatic() const { return m_static; }
+
+        // Tiles are grouped into square chunks, each with its own static mesh
+        static constexpr int kChunkSize = 32;
 
     private:
         int m_width;
@@ -50,12 +76,28 @@ namespace Kiaak::Core
         std::vector<uint8_t> m_tileColliders;
         std::vector<uint32_t> m_colliderObjectIDs; // spawned collider GO ids
         std::shared_ptr<Texture> m_texture;
+        uint32_t m_revision = 0;
+        bool m_static = false;
+
+        struct Chunk
+        {
+            std::unique_ptr<Kiaak::VertexArray> vao;
+            std::unique_ptr<Kiaak::VertexBuffer> vbo;
+            int vertexCount = 0;
+            bool dirty = true;
+        };
+        int m_chunksX = 0;
+        int m_chunksY = 0;
+        std::vector<Chunk> m_chunks;
+
         static std::shared_ptr<Kiaak::Shader> s_shader;
-        static std::shared_ptr<Kiaak::VertexArray> s_vao;
-        static std::shared_ptr<Kiaak::VertexBuffer> s_vbo;
+        static Kiaak::UniformHandle s_uModel, s_uTint, s_uTex, s_uPremultiplied;
         static int s_instances;
         void EnsureResources();
         void EnsureTexture();
-        void UpdateUV(float u0, float v0, float u1, float v1);
+        void ResizeChunks();
+        void MarkChunkDirty(int x, int y);
+        void RebuildChunk(int cx, int cy);
+        void DrawChunks(int cx0, int cy0, int cx1, int cy1);
     };
 }
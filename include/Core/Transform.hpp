@@ -3,15 +3,42 @@
 #include "Component.hpp"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <memory>
 
 namespace Kiaak {
 namespace Core {
 
+/**
+ * 2D affine transform: a 2x3 matrix (columns, like glm) plus a z offset that
+ * passes straight through. Maps (x, y, z) to (cols * (x, y, 1), z + depth).
+ */
+struct Affine2D {
+    glm::vec2 cols[3] = {glm::vec2(1.0f, 0.0f), glm::vec2(0.0f, 1.0f), glm::vec2(0.0f)};
+    float depth = 0.0f;
+
+    glm::vec2 Apply(const glm::vec2& point) const { return cols[0] * point.x + cols[1] * point.y + cols[2]; }
+    Affine2D operator*(const Affine2D& rhs) const;
+    Affine2D Inverse() const;
+    glm::mat4 ToMat4() const;
+    // Drops whatever does not act on the z = 0 plane
+    static Affine2D FromMat4(const glm::mat4& m);
+};
+
 /**
  * Transform component handles position, rotation, and scale of GameObjects
  * Every GameObject automatically has a Transform component
+ * Position/rotation/scale are local to the parent GameObject's Transform (world
+ * space for roots). The world matrix is cached and rebuilt only when this
+ * transform or one of its parents changed; dirtiness is pushed down to the
+ * children when a value is set.
+ * Every world change bumps GetVersion() and lists the transform in its scene's
+ * changed set (Scene::GetChangedTransforms), so consumers only revisit what moved.
+ * State is stored 2D (position + depth, Z angle, XY scale) with 2x3 affine
+ * caches. X/Y rotation and Z scale still work through the vec3 accessors; a
+ * transform that uses them (or has such a parent) keeps its extra state and a
+ * full world matrix in a separately allocated block.
  */
-class Transform : public Component {
+class Transform : public ComponentBase<Transform> {
 public:
     Transform();
     ~Transform() override = default;
@@ -19,23 +46,39 @@ public:
     // Position
     void SetPosition(const glm::vec3& position);
     void SetPosition(float x, float y, float z = 0.0f);
-    const glm::vec3& GetPosition() const { return m_position; }
+    glm::vec3 GetPosition() const { return glm::vec3(m_position, m_depth); }
 
     // Rotation (in degrees)
     void SetRotation(const glm::vec3& rotation);
     void SetRotation(float x, float y, float z);
     void SetRotationZ(float angleDegrees); // Common for 2D
-    const glm::vec3& GetRotation() const { return m_rotation; }
+    glm::vec3 GetRotation() const;
+    float GetRotationZ() const { return m_angle; }
 
     // Scale
     void SetScale(const glm::vec3& scale);
     void SetScale(float x, float y, float z = 1.0f);
     void SetScale(float uniformScale);
-    const glm::vec3& GetScale() const { return m_scale; }
+    glm::vec3 GetScale() const;
 
     // Matrix calculations
-    glm::mat4 GetTransformMatrix() const;
-    glm::mat4 GetModelMatrix() const { return GetTransformMatrix(); }
+    glm::mat4 GetTransformMatrix() const; // local
+    glm::mat4 GetModelMatrix() const { return GetWorldMatrix(); }
+
+    // World space (includes every parent's transform)
+    Transform* GetParent() const;
+    glm::mat4 GetWorldMatrix() const;
+    // The world transform restricted to the z = 0 plane (what 2D consumers need)
+    const Affine2D& GetWorldAffine() const;
+    glm::vec3 GetWorldPosition() const;
+    void SetWorldPosition(const glm::vec3& position);
+    float GetWorldRotationZ() const; // degrees
+    void SetWorldRotationZ(float angleDegrees);
+    glm::vec3 GetWorldScale() const;
+    void SetWorldScale(const glm::vec3& scale);
+    // Changes whenever the world matrix goes stale (never 0); caches built from the
+    // world transform keep the version they saw
+    uint32_t GetVersion() const { return m_version; }
 
     // Relative transformations
     void Translate(const glm::vec3& translation);
@@ -49,16 +92,39 @@ public:
     std::string GetTypeName() const override { return "Transform"; }
 
 private:
-    glm::vec3 m_position;
-    glm::vec3 m_rotation; // Euler angles in degrees
-    glm::vec3 m_scale;
+    // Only transforms that leave the XY plane pay for this
+    struct Extra3D {
+        glm::vec2 rotationXY{0.0f}; // Euler X/Y in degrees
+        float scaleZ = 1.0f;
+        glm::mat4 world{1.0f};      // valid while m_world3D
+    };
+
+    glm::vec2 m_position;
+    float m_depth = 0.0f;
+    float m_angle = 0.0f; // degrees around Z
+    glm::vec2 m_scale;
 
     // Cache for matrix calculation
-    mutable glm::mat4 m_transformMatrix;
+    mutable Affine2D m_localAffine; // sin/cos evaluated once per change
+    mutable Affine2D m_worldAffine;
     mutable bool m_matrixDirty = true;
+    mutable bool m_worldDirty = true; // when set, every child's is set too
+    mutable bool m_world3D = false;   // world matrix lives in m_extra3D
+    mutable std::unique_ptr<Extra3D> m_extra3D;
+    uint32_t m_version = 1;
+    static constexpr uint32_t kNotListed = UINT32_MAX;
+    uint32_t m_changeIndex = kNotListed; // slot in the scene's changed set
+
+    friend class GameObject; // reparenting
+    friend class Scene;      // top-down world matrix pass
 
-    void MarkMatrixDirty() { m_matrixDirty = true; }
-    void UpdateMatrix() const;
+    bool HasLocal3D() const;
+    Extra3D& Ensure3D() const;
+    const Affine2D& GetLocalAffine() const;
+    void MarkMatrixDirty();
+    void MarkWorldDirty();
+    // Rebuilds the world matrix assuming the parent's is current
+    void UpdateWorldMatrix() const;
 };
 
 } // namespace Core
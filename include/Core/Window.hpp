@@ -9,7 +9,8 @@ namespace Kiaak
     class Window
     {
     public:
-        Window(int width, int height, const std::string &title);
+        // headless: no visible window; the context renders offscreen (see Renderer)
+        Window(int width, int height, const std::string &title, bool headless = false);
         ~Window();
 
         bool Initialize();
@@ -25,6 +26,7 @@ namespace Kiaak
         int GetFramebufferWidth() const { return framebufferWidth; }
         int GetFramebufferHeight() const { return framebufferHeight; }
         GLFWwindow *GetNativeWindow() const { return window; }
+        bool IsHeadless() const { return headless; }
 
     private:
         GLFWwindow *window;
@@ -33,6 +35,9 @@ namespace Kiaak
         int framebufferWidth;  // pixel width of framebuffer
         int framebufferHeight; // pixel height of framebuffer
         std::string title;
+        bool headless;
+
+        bool CreateNativeWindow();
 
         // Prevent copying
         Window(const Window &) = delete;
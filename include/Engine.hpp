@@ -21,13 +21,26 @@ namespace Kiaak
         class Camera;
     }
 
+    // Command-line controllable startup settings
+    struct LaunchOptions
+    {
+        bool headless = false;   // hidden window + offscreen framebuffer, no editor UI, starts in play mode
+        int width = 800;
+        int height = 600;
+        int maxFrames = 0;       // stop after N frames (0 = run until closed)
+        std::string capturePath; // write the last frame here as PPM (headless only)
+        std::string projectPath; // overrides last_project.txt
+        std::string sceneName;   // scene to make current after loading
+        int textureBudgetMB = 0; // GPU texture memory budget (0 = unlimited)
+    };
+
     class Engine
     {
     public:
         Engine();
         ~Engine();
 
-        bool Initialize();
+        bool Initialize(const LaunchOptions &options = LaunchOptions());
         void InitLua();
         void Run();
         void Shutdown();
@@ -55,6 +68,7 @@ namespace Kiaak
     private:
         // Core systems
         bool isRunning;
+        LaunchOptions launchOptions;
         std::unique_ptr<Window> window;
         std::unique_ptr<Renderer> renderer;
         std::unique_ptr<Timer> timer;
@@ -117,6 +131,9 @@ namespace Kiaak
         void RenderSelectionGizmo();
         void PaintSelectedTilemap();
         void RenderTilemapGrid();
+        void DrawDebugText(); // DebugDraw text markers via the ImGui foreground list
+        void DrawProfilerOverlay();        // F3 frame timing window
+        void PrintProfilerSummary() const; // frame time percentiles to stdout (headless runs)
 
         // Lua scripting
         std::unique_ptr<sol::state> lua;
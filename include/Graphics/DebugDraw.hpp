@@ -0,0 +1,68 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Kiaak
+{
+
+    class Shader;
+    class VertexArray;
+
+    // Immediate-mode debug shapes in world space. Calls only append to CPU-side
+    // lists; Flush() streams everything through the Renderer's vertex stream
+    // and draws it in at most two calls (lines, then filled triangles).
+    // Shapes live for one frame and are drawn on top of the scene.
+    class DebugDraw
+    {
+    public:
+        struct TextMarker
+        {
+            glm::vec2 position;
+            glm::vec4 color;
+            std::string text;
+        };
+
+        static void Line(const glm::vec2 &a, const glm::vec2 &b, const glm::vec4 &color);
+        static void Box(const glm::vec2 &min, const glm::vec2 &max, const glm::vec4 &color);
+        static void FilledRect(const glm::vec2 &center, const glm::vec2 &size, const glm::vec4 &color);
+        static void Circle(const glm::vec2 &center, float radius, const glm::vec4 &color, int segments = 32);
+        // Text is not rasterized here; the Engine draws markers over the frame with ImGui.
+        // Headless runs have no ImGui context, so their markers are dropped each frame.
+        static void Text(const glm::vec2 &position, const std::string &text, const glm::vec4 &color = glm::vec4(1.0f));
+
+        // Draw and clear the accumulated shapes (text markers are kept until ClearText)
+        static void Flush();
+        static const std::vector<TextMarker> &GetTextMarkers() { return s_text; }
+        static void ClearText() { s_text.clear(); }
+
+        // Vertices submitted by the last Flush
+        static uint32_t GetLastVertexCount() { return s_lastVertexCount; }
+
+        // Release GL resources (Renderer shutdown)
+        static void Shutdown();
+
+    private:
+        struct Vertex
+        {
+            float x, y;
+            uint32_t rgba; // packed, normalized in the shader
+        };
+
+        static uint32_t Pack(const glm::vec4 &color);
+        static bool EnsureResources();
+        static void Submit(std::vector<Vertex> &verts, unsigned int mode);
+
+        static std::vector<Vertex> s_lines;
+        static std::vector<Vertex> s_triangles;
+        static std::vector<TextMarker> s_text;
+        static std::unique_ptr<Shader> s_shader;
+        static std::unique_ptr<VertexArray> s_vao;
+        static unsigned int s_vaoBuffer;
+        static uint32_t s_lastVertexCount;
+    };
+
+} // namespace Kiaak
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Kiaak
+{
+
+    // Asynchronous color readback through a ring of pixel-pack buffers.
+    // Request() queues a copy of the bound read framebuffer without stalling;
+    // Fetch() hands back the oldest copy once the GPU has finished it, typically
+    // one or two frames later.
+    class FrameReadback
+    {
+    public:
+        explicit FrameReadback(unsigned int slots = 2);
+        ~FrameReadback();
+
+        // Queue a readback of the bound framebuffer; drops the oldest pending copy if the ring is full
+        void Request(int width, int height);
+        // Oldest finished copy as tightly packed RGBA8, bottom row first.
+        // With wait=true blocks until it is ready. Returns false if nothing is pending.
+        bool Fetch(std::vector<uint8_t> &outRGBA, int &outWidth, int &outHeight, bool wait = false);
+        bool HasPending() const { return m_pending > 0; }
+
+        // Write RGBA8 (bottom row first, as read from GL) as a binary PPM
+        static bool WritePPM(const std::string &path, const std::vector<uint8_t> &rgba, int width, int height);
+
+    private:
+        struct Slot
+        {
+            GLuint pbo = 0;
+            GLsync fence = nullptr;
+            int width = 0;
+            int height = 0;
+            size_t capacity = 0;
+        };
+        std::vector<Slot> m_slots;
+        unsigned int m_head = 0;    // next slot to write
+        unsigned int m_pending = 0; // slots written but not fetched
+    };
+
+} // namespace Kiaak
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <glad/glad.h>
+
+namespace Kiaak
+{
+
+    // Offscreen render target: RGBA8 color texture + 24-bit depth renderbuffer
+    class Framebuffer
+    {
+    public:
+        Framebuffer(int width, int height);
+        ~Framebuffer();
+
+        // Reallocate attachments if the size changed
+        bool Resize(int width, int height);
+
+        void Bind() const;
+        static void BindDefault();
+
+        GLuint GetID() const { return m_framebufferID; }
+        GLuint GetColorTexture() const { return m_colorTexture; }
+        int GetWidth() const { return m_width; }
+        int GetHeight() const { return m_height; }
+        bool IsComplete() const { return m_complete; }
+
+    private:
+        void Create();
+        void Destroy();
+
+        GLuint m_framebufferID = 0;
+        GLuint m_colorTexture = 0;
+        GLuint m_depthBuffer = 0;
+        int m_width;
+        int m_height;
+        bool m_complete = false;
+
+        Framebuffer(const Framebuffer &) = delete;
+        Framebuffer &operator=(const Framebuffer &) = delete;
+    };
+
+} // namespace Kiaak
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Kiaak
+{
+    namespace Graphics
+    {
+
+        /**
+         * Per-frame list of draw items ordered by a packed 64-bit sort key.
+         * Storage is kept between frames, so steady-state use does not allocate.
+         *
+         * Key layout (most significant first):
+         *   [63..60] layer   [59..28] z (order-preserving float, all 32 bits)
+         *   [27..20] shader  [19..0] texture
+         * Shader/texture IDs are truncated, which only affects grouping. The sort is
+         * stable, so items with equal keys keep their insertion order.
+         */
+        class RenderQueue
+        {
+        public:
+            enum class Kind : uint8_t
+            {
+                Sprite,
+                Tilemap,
+                StaticLayer // cached static content; renderable is a Graphics::StaticLayer
+            };
+
+            struct Item
+            {
+                uint64_t key;
+                void *renderable; // component (or StaticLayer) matching kind
+                Kind kind;
+                uint8_t flags;
+            };
+
+            // Layers drawn back to front
+            static constexpr uint32_t kLayerWorld = 0;
+
+            void Clear() { m_items.clear(); }
+            void Push(Kind kind, void *renderable, uint32_t layer, float z,
+                      uint32_t shaderID, uint32_t textureID, uint8_t flags = 0);
+            // LSD radix sort on the key (stable, 8-bit digits, skips uniform digits)
+            void Sort();
+
+            const std::vector<Item> &GetItems() const { return m_items; }
+            size_t Size() const { return m_items.size(); }
+
+            static uint64_t MakeKey(uint32_t layer, float z, uint32_t shaderID, uint32_t textureID);
+
+        private:
+            std::vector<Item> m_items;
+            std::vector<Item> m_scratch;
+        };
+
+    } // namespace Graphics
+} // namespace Kiaak
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstdint>
+
+namespace Kiaak
+{
+
+    // Shadow copy of the GL state the engine touches. Setters skip calls that
+    // would not change anything and getters answer from the shadow copy, so the
+    // render path never has to read state back from the driver.
+    // Renderer resets it once the context exists; code that changes GL state
+    // behind its back (e.g. third party renderers) must restore it or call Invalidate().
+    class RenderState
+    {
+    public:
+        static constexpr unsigned int kMaxTextureUnits = 16;
+
+        struct Stats
+        {
+            uint64_t issued = 0;  // GL calls actually made
+            uint64_t skipped = 0; // redundant calls elided / queries answered from the cache
+        };
+
+        // Forget everything: the next call of each kind is always issued
+        static void Invalidate();
+
+        // Per-frame counters; BeginFrame moves the running counters into the last-frame slot
+        static void BeginFrame();
+        static const Stats &GetFrameStats() { return s_lastFrame; }
+        static const Stats &GetTotalStats() { return s_total; }
+
+        static void UseProgram(GLuint program);
+        static void ActiveTexture(unsigned int unit);
+        static void BindTexture(unsigned int unit, GLuint texture);
+        static void BindTexture(GLuint texture); // on the currently active unit
+        static void BindVertexArray(GLuint vao);
+        static void BindBuffer(GLenum target, GLuint buffer);
+        // glBindBufferBase also changes the generic binding of the target
+        static void BindBufferBase(GLenum target, GLuint index, GLuint buffer);
+        static void BindFramebuffer(GLuint framebuffer); // GL_FRAMEBUFFER (draw + read)
+        static GLuint GetFramebuffer() { return s_framebuffer == kUnknown ? 0 : s_framebuffer; }
+
+        static void SetBlend(bool enabled);
+        static void SetBlendFunc(GLenum src, GLenum dst);
+        static void SetBlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+        static void SetDepthTest(bool enabled);
+        static void SetDepthMask(bool enabled);
+        static void SetViewport(int x, int y, int width, int height);
+
+        static bool IsBlendEnabled();
+        static bool IsDepthTestEnabled();
+        static bool IsDepthMaskEnabled();
+        static void GetBlendFunc(GLenum out[4]); // srcRGB, dstRGB, srcAlpha, dstAlpha (0 = unknown)
+        static void GetViewport(int out[4]);
+        static int GetViewportWidth();
+        static int GetViewportHeight();
+
+        // Keep the shadow copy valid when objects die (GL unbinds deleted names)
+        static void OnDeleteProgram(GLuint program);
+        static void OnDeleteTexture(GLuint texture);
+        static void OnDeleteVertexArray(GLuint vao);
+        static void OnDeleteBuffer(GLuint buffer);
+        static void OnDeleteFramebuffer(GLuint framebuffer);
+
+    private:
+        enum BufferSlot
+        {
+            ArrayBuffer = 0,
+            ElementBuffer,
+            UniformBuffer,
+            PixelPackBuffer,
+            PixelUnpackBuffer,
+            CopyReadBuffer,
+            CopyWriteBuffer,
+            BufferSlotCount
+        };
+        static int BufferSlotFor(GLenum target);
+
+        static constexpr GLuint kUnknown = 0xFFFFFFFFu;
+
+        static GLuint s_program;
+        static unsigned int s_activeUnit;
+        static GLuint s_textures[kMaxTextureUnits];
+        static GLuint s_vao;
+        static GLuint s_framebuffer;
+        static GLuint s_buffers[BufferSlotCount];
+        static int8_t s_blend, s_depthTest, s_depthMask; // -1 = unknown
+        static GLenum s_blendSrc, s_blendDst, s_blendSrcAlpha, s_blendDstAlpha;
+        static int s_viewport[4];
+        static bool s_viewportKnown;
+
+        static Stats s_frame;
+        static Stats s_lastFrame;
+        static Stats s_total;
+
+        static void Issued()
+        {
+            s_frame.issued++;
+            s_total.issued++;
+        }
+        static void Skipped()
+        {
+            s_frame.skipped++;
+            s_total.skipped++;
+        }
+    };
+
+} // namespace Kiaak
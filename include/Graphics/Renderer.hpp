@@ -5,8 +5,14 @@
 #include "Graphics/Texture.hpp"
 #include "Graphics/VertexArray.hpp"
 #include "Graphics/VertexBuffer.hpp"
+#include "Graphics/UniformBuffer.hpp"
+#include "Graphics/StreamBuffer.hpp"
+#include "Graphics/Framebuffer.hpp"
+#include "Graphics/FrameReadback.hpp"
 #include <glm/glm.hpp>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace Kiaak
 {
@@ -23,6 +29,37 @@ namespace Kiaak
         void Clear(float r, float g, float b, float a = 1.0f);
         void Shutdown();
 
+        // std140 layout of the shared "Camera" uniform block (binding kCameraBlockBinding)
+        struct CameraUniforms
+        {
+            glm::mat4 view;
+            glm::mat4 projection;
+            glm::mat4 viewProjection;
+            glm::vec4 viewportTime; // xy = viewport size in pixels, z = time in seconds
+        };
+
+        // Upload the active camera's matrices; called once per frame by BeginFrame
+        void UpdateCameraUniforms();
+        const CameraUniforms &GetCameraUniforms() const { return m_cameraData; }
+        // Temporarily render through another camera (e.g. into a cached layer);
+        // RestoreCameraUniforms puts this frame's camera back
+        static void OverrideCameraUniforms(const glm::mat4 &view, const glm::mat4 &projection, int viewportWidth, int viewportHeight);
+        static void RestoreCameraUniforms();
+
+        // Headless windows render into an offscreen framebuffer and never swap
+        bool IsOffscreen() const { return m_offscreen != nullptr; }
+        Framebuffer *GetOffscreenTarget() const { return m_offscreen.get(); }
+
+        // Asynchronous readback of each finished frame (offscreen only, off by default)
+        void SetFrameReadback(bool enabled);
+        // Oldest finished frame as RGBA8, bottom row first; wait=true blocks until ready
+        bool FetchFrame(std::vector<uint8_t> &outRGBA, int &outWidth, int &outHeight, bool wait = false);
+        // Write the most recently ended frame to a PPM file (blocks on the GPU)
+        bool CaptureFrame(const std::string &path);
+
+        // Shared ring for per-frame vertex data (nullptr before Initialize)
+        static StreamBuffer *GetVertexStream() { return s_vertexStream; }
+
         // Simple quad drawing for gizmos and debug rendering
         void DrawQuad(const glm::vec3 &position, const glm::vec2 &size, const glm::vec4 &color);
 
@@ -34,8 +71,19 @@ namespace Kiaak
         const Window *targetWindow;
         bool isInitialized;
 
+        std::unique_ptr<UniformBuffer> m_cameraUBO;
+        std::unique_ptr<StreamBuffer> m_vertexStream;
+        std::unique_ptr<Framebuffer> m_offscreen;
+        std::unique_ptr<FrameReadback> m_readback;
+        bool m_readbackEveryFrame = false;
+        static StreamBuffer *s_vertexStream;
+        static UniformBuffer *s_cameraBuffer;
+        static const CameraUniforms *s_frameCamera;
+        CameraUniforms m_cameraData{};
+
         // Quad rendering resources
         std::unique_ptr<Kiaak::Shader> m_quadShader;
+        UniformHandle m_quadModel, m_quadColor, m_quadTexture;
         std::unique_ptr<Texture> m_whiteTexture;
         std::unique_ptr<Kiaak::VertexArray> m_quadVAO;
         std::unique_ptr<Kiaak::VertexBuffer> m_quadVBO;
@@ -1,11 +1,21 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
 namespace Kiaak {
 
+// Pre-resolved reference to an active uniform of one Shader. Resolve once with
+// Shader::GetUniformHandle and keep it; an invalid handle makes Set a no-op.
+struct UniformHandle {
+    int index = -1;
+    bool IsValid() const { return index >= 0; }
+};
+
 class Shader {
 public:
     Shader();
@@ -14,8 +24,24 @@ public:
     bool LoadFromFile(const std::string& vertexPath, const std::string& fragmentPath);
     bool LoadFromString(const std::string& vertexSource, const std::string& fragmentSource);
     void Use();
+    unsigned int GetID() const { return programID; }
+    // True if the program declares the shared "Camera" uniform block
+    bool UsesCameraBlock() const { return usesCameraBlock; }
+
+    // Look up a uniform reflected at link time (arrays also answer to their base name)
+    UniformHandle GetUniformHandle(const std::string& name) const;
 
-    // Uniform setters
+    // Handle-based setters; uploads are skipped when the value is unchanged
+    void Set(UniformHandle handle, bool value);
+    void Set(UniformHandle handle, int value);
+    void Set(UniformHandle handle, float value);
+    void Set(UniformHandle handle, const glm::vec2& value);
+    void Set(UniformHandle handle, const glm::vec3& value);
+    void Set(UniformHandle handle, const glm::vec4& value);
+    void Set(UniformHandle handle, const glm::mat3& value);
+    void Set(UniformHandle handle, const glm::mat4& value);
+
+    // Uniform setters by name (hashed lookup, then same as above)
     void SetBool(const std::string& name, bool value);
     void SetInt(const std::string& name, int value);
     void SetFloat(const std::string& name, float value);
@@ -29,9 +55,24 @@ private:
     bool CompileShader(const std::string& source, unsigned int type, unsigned int& shaderId);
     bool CheckShaderErrors(unsigned int shader, const std::string& type);
     bool CheckProgramErrors(unsigned int program);
+    void ReflectUniforms();
+    // Returns the cached copy to write into, or nullptr if the upload can be skipped
+    unsigned char* BeginUpload(UniformHandle handle, const void* data, size_t size);
+
+    struct Uniform {
+        std::string name;
+        int location = -1;
+        unsigned int type = 0;
+        int size = 0;                // array length
+        bool cached = false;         // last uploaded value is known
+        unsigned char value[64] = {}; // large enough for a mat4
+    };
 
     unsigned int programID;
     bool isCompiled;
+    bool usesCameraBlock = false;
+    std::vector<Uniform> uniforms;
+    std::unordered_map<std::string, int> uniformIndex;
 };
 
 } // namespace Kiaak
\ No newline at end of file
@@ -18,7 +18,7 @@ namespace Kiaak
          * SpriteRenderer component for rendering 2D sprites
          * This replaces the old Sprite class as a component
          */
-        class SpriteRenderer : public Core::Component
+        class SpriteRenderer : public Core::ComponentBase<SpriteRenderer>
         {
         public:
             SpriteRenderer();
@@ -39,22 +39,33 @@ namespace Kiaak
             void SetVisible(bool visible) { m_visible = visible; }
             bool IsVisible() const { return m_visible; }
 
+            // Static sprites are drawn through the scene's cached static layers
+            void SetStatic(bool isStatic) { m_static = isStatic; }
+            bool IsStatic() const { return m_static; }
+
             // Sprite properties
-            void SetSize(const glm::vec2 &size) { m_size = size; }
-            void SetSize(float width, float height) { m_size = glm::vec2(width, height); }
+            void SetSize(const glm::vec2 &size);
+            void SetSize(float width, float height) { SetSize(glm::vec2(width, height)); }
             const glm::vec2 &GetSize() const { return m_size; }
+            // Adopt the texture's size once its async load has landed (Scene::Render calls this before culling)
+            void ApplyTextureSize();
 
             // UV coordinates sub-rectangle (u0,v0,u1,v1) within the texture
-            // Updates the underlying quad's UVs so no special shader logic is required.
+            // A rect is streamed on the frame it changes and copied into the sprite's own quad once it holds.
             void SetUVRect(const glm::vec4 &uvRect);
             const glm::vec4 &GetUVRect() const { return m_uvRect; }
 
             // Rendering
             void Render();
 
+            // World-space AABB of the rotated/scaled quad (used for culling)
+            void GetWorldAABB(glm::vec2 &outMin, glm::vec2 &outMax) const;
+
+            // Shared sprite shader (nullptr until the first Start)
+            static Shader *GetSharedShader() { return s_spriteShader.get(); }
+
             // Component interface
             void Start() override;
-            void Update(double deltaTime) override {}
             std::string GetTypeName() const override { return "SpriteRenderer"; }
 
         private:
@@ -68,16 +79,28 @@ namespace Kiaak
             glm::vec2 m_size = glm::vec2(1.0f);                     // Default size
             glm::vec4 m_uvRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f); // Full texture
             bool m_visible = true;
+            bool m_static = false;
+            bool m_uvDirty = false;   // static quad UVs lag m_uvRect
+            bool m_uvChanged = false; // m_uvRect set since the last draw
+            bool m_sizeFromTexture = false; // take m_size from the texture once its async load lands
 
             // Static shared resources
             static std::shared_ptr<Shader> s_spriteShader;
+            static UniformHandle s_uModel;     // with the shared Camera block
+            static UniformHandle s_uTransform; // legacy combined VP * model
+            static UniformHandle s_uTexture;
+            static UniformHandle s_uPremultiplied;
             static std::shared_ptr<Texture> s_defaultTexture;
             static int s_rendererCount;
+            static std::unique_ptr<VertexArray> s_streamVAO; // attributes over Renderer's vertex stream
+            static unsigned int s_streamVAOBuffer;
 
             // Internal methods
             void CreateQuad();
             void UpdateQuadUVs(); // rebuilds quad UVs from m_uvRect (no special shader needed)
             void UpdateQuadSize();
+            void InvalidateBounds(); // tells the scene the world AABB changed
+            bool DrawStreamed(); // false if the stream is unavailable or full
             void InitializeShader();
             void CleanupShader();
             void CreateDefaultTexture();
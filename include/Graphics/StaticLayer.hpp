@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Graphics/Shader.hpp"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace Kiaak
+{
+
+    class Framebuffer;
+    class VertexArray;
+
+    namespace Graphics
+    {
+
+        /**
+         * Cached render target for content that rarely changes (static tilemaps and
+         * sprites sharing one depth). The cache covers the view plus a margin on every
+         * side at screen resolution. When the camera scrolls past the margin the kept
+         * pixels are shifted and only the newly exposed strips are redrawn; a different
+         * content hash, zoom or viewport size redraws everything.
+         * Composite() draws the layer as a single textured quad (premultiplied alpha).
+         */
+        class StaticLayer
+        {
+        public:
+            // Draw the layer's content; only the given world rectangle needs to be covered
+            using DrawFn = std::function<void(const glm::vec2 &worldMin, const glm::vec2 &worldMax)>;
+
+            // z: depth the cached layer is composited at
+            explicit StaticLayer(float z);
+            ~StaticLayer();
+
+            // Bring the cache up to date for this view. False if no cache could be made;
+            // the caller should then draw the content directly.
+            bool Update(const glm::vec2 &viewMin, const glm::vec2 &viewMax, int viewportWidth, int viewportHeight,
+                        uint64_t contentHash, const DrawFn &draw);
+            // Draw the cached layer through the current camera
+            void Composite() const;
+            float GetDepth() const { return m_depth; }
+            void Invalidate() { m_valid = false; }
+
+            // Regions redrawn by the last Update (0 = served entirely from the cache)
+            int GetLastRedrawCount() const { return m_lastRedraws; }
+
+            // Release the shared composite shader (Renderer shutdown)
+            static void Shutdown();
+
+            // Extra texels kept around the view on each side
+            static constexpr int kMinMargin = 64;
+
+        private:
+            bool EnsureTargets(int width, int height);
+            void BeginDraw();
+            void EndDraw();
+            // Clear and redraw a cache-local texel rectangle [x0, x1) x [y0, y1)
+            void Redraw(int x0, int y0, int x1, int y1, const DrawFn &draw);
+            void Shift(int dx, int dy);
+            glm::vec2 TexelToWorld(int x, int y) const;
+            static bool EnsureShader();
+
+            float m_depth;
+            std::unique_ptr<Framebuffer> m_targets[2]; // ping-pong for scrolling
+            int m_current = 0;
+            int m_width = 0;
+            int m_height = 0;
+            glm::vec2 m_texelSize{0.0f};
+            int m_originX = 0; // cache min corner, in texels from the world origin
+            int m_originY = 0;
+            uint64_t m_hash = 0;
+            bool m_valid = false;
+            int m_lastRedraws = 0;
+
+            // Saved around cache drawing
+            GLuint m_prevFramebuffer = 0;
+            int m_prevViewport[4] = {0, 0, 0, 0};
+            GLenum m_prevBlend[4] = {0, 0, 0, 0};
+            bool m_prevBlendEnabled = false;
+
+            static std::unique_ptr<Shader> s_shader;
+            static std::unique_ptr<VertexArray> s_vao; // attributeless quad
+            static UniformHandle s_uRect, s_uZ, s_uTex;
+        };
+
+    } // namespace Graphics
+} // namespace Kiaak
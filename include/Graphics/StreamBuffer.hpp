@@ -0,0 +1,67 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <vector>
+
+namespace Kiaak
+{
+
+    // Ring buffer for geometry that changes every frame. The buffer is split into
+    // one region per frame in flight; each region is fenced when the frame ends and
+    // only written again once the GPU has passed that fence, so writes never stall.
+    //
+    // Backends, best first:
+    //  - Persistent: GL_ARB_buffer_storage, mapped once for the buffer's lifetime
+    //  - Unsynchronized: glMapBufferRange(UNSYNCHRONIZED) per allocation, fenced;
+    //    small allocations are staged and written with glBufferSubData instead
+    //  - Orphan: CPU staging + glBufferSubData, storage orphaned on wrap
+    class StreamBuffer
+    {
+    public:
+        enum class Mode
+        {
+            Persistent,
+            Unsynchronized,
+            Orphan
+        };
+
+        StreamBuffer(GLenum target, unsigned int bytesPerFrame, unsigned int framesInFlight = 3);
+        ~StreamBuffer();
+
+        // Reserve `size` bytes in the current frame's region. Returns a write pointer
+        // or nullptr if the region is full; outOffset is the byte offset in the buffer.
+        // Every successful Allocate must be followed by Commit before drawing.
+        void *Allocate(unsigned int size, unsigned int alignment, unsigned int &outOffset);
+        void Commit();
+
+        // Fence the current region and move to the next one (once per frame)
+        void EndFrame();
+
+        GLuint GetID() const { return m_bufferID; }
+        GLenum GetTarget() const { return m_target; }
+        Mode GetMode() const { return m_mode; }
+        unsigned int GetFrameUsage() const { return m_head - m_regionStart; }
+
+    private:
+        void WaitForRegion(unsigned int region);
+
+        GLenum m_target;
+        GLuint m_bufferID = 0;
+        Mode m_mode = Mode::Orphan;
+        unsigned int m_regionSize;
+        unsigned int m_regionCount;
+        unsigned int m_region = 0;
+        unsigned int m_regionStart = 0;
+        unsigned int m_head = 0;
+        unsigned char *m_persistent = nullptr; // Persistent mode
+        std::vector<GLsync> m_fences;
+
+        // Pending allocation (Unsynchronized / Orphan)
+        void *m_pending = nullptr;
+        unsigned int m_pendingOffset = 0;
+        unsigned int m_pendingSize = 0;
+        bool m_pendingMapped = false;
+        std::vector<unsigned char> m_staging; // Orphan mode, small Unsynchronized writes
+    };
+
+} // namespace Kiaak
@@ -1,8 +1,17 @@
 #pragma once
 
 #include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_set>
+#include <vector>
+
+namespace Kiaak
+{
+    class TextureLoader;
+    class CookedTexture;
+}
 
 /**
  * Texture class manages OpenGL textures for 2D rendering
@@ -13,7 +22,8 @@
  * - Managing texture parameters (filtering, wrapping)
  * - Binding textures for rendering
  *
- * Supported formats: PNG, JPG, BMP, TGA
+ * Supported formats: PNG, JPG, BMP, TGA, and cooked .ktex files (see TextureCook),
+ * which are preferred over the source image when up to date
  */
 class Texture
 {
@@ -22,7 +32,13 @@ private:
     int m_width;            // Texture width in pixels
     int m_height;           // Texture height in pixels
     int m_channels;         // Number of color channels (3=RGB, 4=RGBA)
+    int m_mipLevels = 1;    // levels in the GL texture (1 = no mipmaps)
+    bool m_premultiplied = false; // color already multiplied by alpha (cooked textures)
     std::string m_filePath; // Path to source image file
+    bool m_pending = false; // queued on the TextureLoader; binds as a placeholder until uploaded
+    bool m_evicted = false; // GL storage dropped for the memory budget; reloaded from m_filePath on use
+    size_t m_gpuBytes = 0;  // estimated GPU storage while resident
+    uint64_t m_lastUseFrame = 0;
 
     // Apply current global filter mode to this texture (if valid)
     void ApplyFilterParameters() const;
@@ -99,7 +115,19 @@ public:
     int GetChannels() const { return m_channels; }
 
     /**
-     * Get OpenGL texture ID
+     * Get number of mip levels
+     * @return 1 when the texture has no mipmaps
+     */
+    int GetMipLevels() const { return m_mipLevels; }
+
+    /**
+     * Check if color is stored premultiplied by alpha; shaders divide it back out
+     * @return true for cooked textures
+     */
+    bool IsPremultiplied() const { return m_premultiplied; }
+
+    /**
+     * Get OpenGL texture ID (0 while evicted; call EnsureResident() before using it directly)
      * @return OpenGL texture object ID
      */
     GLuint GetID() const { return m_textureID; }
@@ -108,7 +136,31 @@ public:
      * Check if texture is valid (loaded successfully)
      * @return true if texture is valid, false otherwise
      */
-    bool IsValid() const { return m_textureID != 0; }
+    bool IsValid() const { return m_textureID != 0 || m_evicted; }
+
+    /**
+     * Check if an asynchronous load is still in flight
+     * @return true while decoding/uploading (size is 0x0 until then)
+     */
+    bool IsPending() const { return m_pending; }
+
+    /**
+     * Check if the GL storage was dropped to stay within the memory budget
+     * @return true until the next Bind/EnsureResident reloads it
+     */
+    bool IsEvicted() const { return m_evicted; }
+
+    /**
+     * Estimated GPU memory held by this texture
+     * @return Bytes resident (0 while pending or evicted)
+     */
+    size_t GetGpuBytes() const { return m_gpuBytes; }
+
+    /**
+     * Reload an evicted texture now and mark it used this frame
+     * @return true if the texture has GL storage afterwards
+     */
+    bool EnsureResident();
 
     /**
      * Get file path of loaded texture
@@ -116,12 +168,43 @@ public:
      */
     const std::string &GetFilePath() const { return m_filePath; }
 
+    /**
+     * Decode an image file into tightly packed rows, bottom row first (OpenGL order).
+     * Safe to call from any thread; touches no GL or global stb state.
+     * @return true on success; error receives the reason otherwise
+     */
+    static bool DecodeFile(const std::string &filePath, std::vector<unsigned char> &outPixels,
+                           int &outWidth, int &outHeight, int &outChannels, std::string *error = nullptr);
+
     // -------- Global filtering control --------
     // Set the global filter mode (applies to all existing textures immediately)
     static void SetGlobalFilterMode(FilterMode mode);
     static FilterMode GetGlobalFilterMode();
 
+    // -------- GPU memory budget --------
+    // Textures loaded from files that were not used last frame are evicted, least
+    // recently used first, while the resident total exceeds the budget (0 = unlimited)
+    static void SetMemoryBudget(size_t bytes);
+    static size_t GetMemoryBudget() { return s_memoryBudget; }
+    static size_t GetResidentBytes() { return s_residentBytes; }
+    static uint64_t GetEvictionCount() { return s_evictionCount; }
+    static uint64_t GetReloadCount() { return s_reloadCount; }
+    // Advance the use clock and enforce the budget (Renderer::BeginFrame)
+    static void BeginFrame();
+
 private:
+    friend class Kiaak::TextureLoader;
+
+    /**
+     * Create the GL texture; pixels may be an offset into a bound pixel unpack buffer
+     */
+    bool Upload(const void *pixels, int width, int height, int channels);
+
+    /**
+     * Create the GL texture from a cooked file, level by level without decoding
+     */
+    bool UploadCooked(const Kiaak::CookedTexture &cooked);
+
     /**
      * Set up OpenGL texture parameters (filtering, wrapping)
      */
@@ -132,7 +215,18 @@ private:
      */
     void Cleanup();
 
+    /**
+     * Drop the GL storage but keep size and path so it can be reloaded
+     */
+    void Evict();
+
     // Registry of all live Texture instances to support global filter changes
     static std::unordered_set<Texture *> s_allTextures;
     static FilterMode s_currentFilterMode;
+
+    static size_t s_memoryBudget;
+    static size_t s_residentBytes;
+    static uint64_t s_frame;
+    static uint64_t s_evictionCount;
+    static uint64_t s_reloadCount;
 };
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Graphics/Texture.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace Kiaak
+{
+
+    // Shared textures keyed by resolved file path + modification time, so every
+    // sprite, tilemap, animator and editor preview using the same image shares one
+    // GL texture. The cache holds a reference of its own; entries nobody else uses
+    // stay until EvictUnused(). A file that changed on disk gets a fresh entry;
+    // holders of the old texture keep it until they let go.
+    class TextureCache
+    {
+    public:
+        struct Stats
+        {
+            size_t entries = 0;
+            size_t referenced = 0;    // entries used outside the cache
+            size_t residentBytes = 0; // GPU bytes of entries not evicted
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t evictions = 0;
+        };
+
+        // nullptr if the file doesn't exist (or a synchronous load failed).
+        // async=false decodes on the calling thread when the entry is new (editor
+        // previews that need the size immediately).
+        static std::shared_ptr<Texture> Get(const std::string &path, bool async = true);
+
+        // Project-relative lookup: as given, else under the project (or ./assets) folder
+        static std::string ResolvePath(const std::string &path);
+
+        // Drop entries only the cache references; returns how many were dropped
+        static size_t EvictUnused();
+
+        static Stats GetStats();
+
+        // Release every entry (Renderer shutdown, while the context is alive)
+        static void Clear();
+
+    private:
+        struct Entry
+        {
+            std::shared_ptr<Texture> texture;
+            std::filesystem::file_time_type mtime;
+        };
+
+        static std::unordered_map<std::string, Entry> s_entries;
+        static uint64_t s_hits;
+        static uint64_t s_misses;
+        static uint64_t s_evictions;
+    };
+
+} // namespace Kiaak
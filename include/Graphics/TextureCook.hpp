@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Kiaak
+{
+
+    // Cooked texture container (.ktex), little-endian:
+    //   KTexHeader, KTexLevel[levels], level data (each level 16-byte aligned)
+    // Rows are stored bottom row first like every other texture upload here, so
+    // levels go to GL as they are without decoding.
+    enum class KTexFormat : uint32_t
+    {
+        RGBA8 = 0,
+        BC3 = 1 // DXT5, needs GL_EXT_texture_compression_s3tc
+    };
+
+    struct KTexHeader
+    {
+        char magic[4]; // "KTEX"
+        uint32_t version;
+        uint32_t format; // KTexFormat
+        uint32_t width;
+        uint32_t height;
+        uint32_t levels;
+        uint32_t flags; // kKTexPremultiplied
+        uint32_t reserved;
+    };
+
+    struct KTexLevel
+    {
+        uint32_t width;
+        uint32_t height;
+        uint64_t offset; // from the start of the file
+        uint64_t size;
+    };
+
+    constexpr uint32_t kKTexVersion = 1;
+    constexpr uint32_t kKTexPremultiplied = 1u << 0;
+
+    // A .ktex file opened for upload: memory-mapped where available, read into
+    // memory otherwise. Safe to open on any thread.
+    class CookedTexture
+    {
+    public:
+        ~CookedTexture();
+        CookedTexture(const CookedTexture &) = delete;
+        CookedTexture &operator=(const CookedTexture &) = delete;
+
+        // nullptr (with the reason in error) if missing or malformed
+        static std::unique_ptr<CookedTexture> Open(const std::string &path, std::string *error = nullptr);
+
+        const KTexHeader &GetHeader() const { return *m_header; }
+        KTexFormat GetFormat() const { return static_cast<KTexFormat>(m_header->format); }
+        bool IsPremultiplied() const { return (m_header->flags & kKTexPremultiplied) != 0; }
+        uint32_t GetLevelCount() const { return m_header->levels; }
+        const KTexLevel &GetLevel(uint32_t i) const { return m_levels[i]; }
+        const unsigned char *GetLevelData(uint32_t i) const { return m_data + m_levels[i].offset; }
+        // Bytes of pixel data over all levels
+        size_t GetDataSize() const;
+
+    private:
+        CookedTexture() = default;
+
+        const unsigned char *m_data = nullptr;
+        size_t m_size = 0;
+        bool m_mapped = false;
+        std::vector<unsigned char> m_buffer; // fallback when mapping isn't possible
+        const KTexHeader *m_header = nullptr;
+        const KTexLevel *m_levels = nullptr;
+    };
+
+    // Asset cook step: decodes source images once and writes .ktex files next to
+    // them with a full premultiplied-alpha mip chain, optionally BC3 compressed.
+    // Texture loads prefer an up-to-date cooked file over decoding the source.
+    class TextureCook
+    {
+    public:
+        struct Options
+        {
+            bool compress = false; // BC3 (4:1 for RGBA8)
+            bool force = false;    // re-cook files that are up to date
+        };
+
+        static bool CookFile(const std::string &sourcePath, const std::string &cookedPath, const Options &options);
+        // Cook every PNG/JPG/BMP/TGA below a directory; returns how many files were written (-1 on error)
+        static int CookDirectory(const std::string &directory, const Options &options);
+
+        // "sprites/player.png" -> "sprites/player.png.ktex"
+        static std::string GetCookedPath(const std::string &sourcePath);
+        // Cooked file to load instead of sourcePath, or "" if none is up to date
+        static std::string FindCooked(const std::string &sourcePath);
+    };
+
+} // namespace Kiaak
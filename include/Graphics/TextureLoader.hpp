@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Graphics/Texture.hpp"
+#include "Graphics/TextureCook.hpp"
+#include <glad/glad.h>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Kiaak
+{
+
+    // Asynchronous texture loading. Load() returns at once; PNG/JPG decoding (or
+    // mapping an up-to-date cooked .ktex) runs on a small worker pool and the GL
+    // upload happens in Update() on the render thread, limited to a byte budget per
+    // frame. Decoded images go through a pixel unpack buffer; cooked levels upload
+    // straight from the mapped file.
+    // Until then the texture binds as a 1x1 white placeholder and reports 0x0.
+    class TextureLoader
+    {
+    public:
+        static std::shared_ptr<Texture> Load(const std::string &filePath);
+
+        // Upload finished decodes (GL thread, once per frame from Renderer::BeginFrame).
+        // At least one texture is uploaded per call so large images still make progress.
+        static void Update();
+
+        static void SetUploadBudget(size_t bytesPerFrame) { s_uploadBudget = bytesPerFrame; }
+        static size_t GetUploadBudget() { return s_uploadBudget; }
+
+        // Queued, decoding or waiting for upload
+        static size_t GetPendingCount();
+        // Bytes uploaded by the last Update
+        static size_t GetLastUploadBytes() { return s_lastUploadBytes; }
+
+        // 1x1 white texture bound in place of textures that are still loading
+        static GLuint GetPlaceholderID();
+
+        // Stop the workers and release GL objects (Renderer shutdown)
+        static void Shutdown();
+
+    private:
+        struct Job
+        {
+            std::string path;
+            std::weak_ptr<Texture> target;
+        };
+
+        struct Decoded
+        {
+            std::string path;
+            std::weak_ptr<Texture> target;
+            std::vector<unsigned char> pixels;
+            int width = 0;
+            int height = 0;
+            int channels = 0;
+            std::unique_ptr<CookedTexture> cooked; // set instead of pixels
+            bool ok = false;
+            std::string error;
+
+            size_t Bytes() const { return cooked ? cooked->GetDataSize() : pixels.size(); }
+        };
+
+        static void StartWorkers();
+        static void WorkerMain();
+        static void Upload(Texture &texture, const Decoded &image);
+
+        static std::vector<std::thread> s_workers;
+        static std::mutex s_mutex;
+        static std::condition_variable s_wake;
+        static std::deque<Job> s_jobs;
+        static std::deque<Decoded> s_done;
+        static size_t s_decoding;
+        static bool s_stopping;
+
+        static size_t s_uploadBudget;
+        static size_t s_lastUploadBytes;
+        static GLuint s_unpackBuffer;
+        static GLuint s_placeholder;
+    };
+
+} // namespace Kiaak
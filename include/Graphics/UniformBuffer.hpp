@@ -0,0 +1,29 @@
+#pragma once
+
+#include <glad/glad.h>
+
+namespace Kiaak
+{
+
+    // Fixed binding points shared by the engine and every shader that declares the block
+    static constexpr unsigned int kCameraBlockBinding = 0;
+
+    class UniformBuffer
+    {
+    public:
+        UniformBuffer(unsigned int size, unsigned int binding);
+        ~UniformBuffer();
+
+        // Update part of the buffer (offset/size in bytes)
+        void SetData(const void *data, unsigned int size, unsigned int offset = 0);
+
+        unsigned int GetBinding() const { return m_binding; }
+        unsigned int GetID() const { return m_bufferID; }
+
+    private:
+        unsigned int m_bufferID;
+        unsigned int m_size;
+        unsigned int m_binding;
+    };
+
+} // namespace Kiaak
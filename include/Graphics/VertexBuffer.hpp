@@ -12,11 +12,12 @@ public:
     void Bind() const;
     void Unbind() const;
     
-    // Update buffer data
+    // Update buffer data (in place when it fits, otherwise reallocates as dynamic)
     void SetData(const void* data, unsigned int size);
 
 private:
     unsigned int m_bufferID;
+    unsigned int m_size = 0;
 };
 
 } // namespace Kiaak
@@ -45,7 +45,7 @@ void Animator::Update(double deltaTime)
     if (sr)
     {
         sr->SetUVRect(glm::vec4(u0, v0, u1, v1));
-        if (!clip.texturePath.empty() && (!sr->GetTexture() || sr->GetTexturePath() != clip.texturePath))
+        if (!clip.texturePath.empty() && sr->GetTexturePath() != clip.texturePath)
         {
             sr->SetTexture(clip.texturePath);
         }
@@ -98,7 +98,7 @@ void Animator::ApplyAutoPlay()
         if (auto *sr = GetGameObject()->GetComponent<Graphics::SpriteRenderer>())
         {
             sr->SetUVRect(glm::vec4(u0, v0, u1, v1));
-            if (!clip.texturePath.empty() && (!sr->GetTexture() || sr->GetTexturePath() != clip.texturePath))
+            if (!clip.texturePath.empty() && sr->GetTexturePath() != clip.texturePath)
                 sr->SetTexture(clip.texturePath);
             // Initial adjust of size if currently full sheet
             if (sr->GetTexture())
@@ -2,8 +2,10 @@
 #include "Core/GameObject.hpp"
 #include "Core/Scene.hpp"
 #include "Core/Transform.hpp"
+#include "Graphics/RenderState.hpp"
 #include <glm/gtc/matrix_transform.hpp>
 #include <glad/glad.h>
+#include <iostream>
 
 namespace Kiaak
 {
@@ -71,7 +73,10 @@ namespace Kiaak
 
         const glm::mat4 &Camera::GetView() const
         {
-            if (m_viewDirty)
+            // Only re-invert when the camera (or one of its parents) actually moved
+            const GameObject *owner = GetGameObject();
+            const Transform *t = owner ? owner->GetTransform() : nullptr;
+            if (m_viewDirty || (t && t->GetVersion() != m_viewVersion))
             {
                 RecalculateView();
                 m_viewDirty = false;
@@ -83,8 +88,8 @@ namespace Kiaak
         {
             // If the framebuffer/viewport size changed, the aspect changed → rebuild P.
             static int lastVPW = -1, lastVPH = -1; // shared across cams is fine for 2D/editor
-            GLint vp[4] = {0, 0, 0, 0};
-            glGetIntegerv(GL_VIEWPORT, vp);
+            int vp[4] = {0, 0, 0, 0};
+            RenderState::GetViewport(vp);
             const int vpw = vp[2];
             const int vph = vp[3];
             if (vpw != lastVPW || vph != lastVPH)
@@ -102,19 +107,35 @@ namespace Kiaak
             return m_proj;
         }
 
+        void Camera::GetWorldBounds(glm::vec2 &outMin, glm::vec2 &outMax) const
+        {
+            const glm::mat4 invVP = glm::inverse(GetViewProjection());
+            const glm::vec2 ndc[4] = {{-1.0f, -1.0f}, {1.0f, -1.0f}, {1.0f, 1.0f}, {-1.0f, 1.0f}};
+            for (int i = 0; i < 4; ++i)
+            {
+                glm::vec4 w = invVP * glm::vec4(ndc[i].x, ndc[i].y, 0.0f, 1.0f);
+                if (w.w != 0.0f)
+                    w /= w.w;
+                glm::vec2 p(w.x, w.y);
+                outMin = i == 0 ? p : glm::min(outMin, p);
+                outMax = i == 0 ? p : glm::max(outMax, p);
+            }
+        }
+
         void Camera::RecalculateView() const
         {
             // Use inverse of the GameObject transform as the view
             // (camera looks down -Z with up +Y; 2D sprites live in XY plane)
             const Transform *t = GetGameObject()->GetTransform();
-            glm::mat4 model = t ? t->GetTransformMatrix() : glm::mat4(1.0f);
+            glm::mat4 model = t ? t->GetWorldMatrix() : glm::mat4(1.0f);
             m_view = glm::inverse(model);
+            m_viewVersion = t ? t->GetVersion() : 0;
         }
 
         void Camera::RecalculateProjection() const
         {
-            GLint vp[4] = {0, 0, 0, 0};
-            glGetIntegerv(GL_VIEWPORT, vp);
+            int vp[4] = {0, 0, 0, 0};
+            RenderState::GetViewport(vp);
             float w = static_cast<float>(vp[2]);
             float h = static_cast<float>(vp[3]);
             if (w <= 0.0f)
@@ -140,45 +161,52 @@ namespace Kiaak
             m_followTargetID = id;
         }
 
+        GameObject *Camera::GetFollowTarget() const
+        {
+            if (m_followTargetID == 0)
+                return nullptr;
+            auto *owner = GetGameObject();
+            auto *scene = owner ? owner->GetScene() : nullptr;
+            return scene ? scene->GetGameObject(m_followTargetID) : nullptr;
+        }
+
         // Note: follow logic implemented in Update by resolving the ID to a GameObject
         void Camera::Update(double /*deltaTime*/)
         {
-            // If transform moved/rotated/scaled, mark view dirty.
-            m_viewDirty = true;
-
             // If follow target set, resolve and snap camera to target position (preserve Z)
             if (m_followTargetID != 0)
             {
-                // Resolve owning scene via GameObject lookup (SceneManager available via GameObject?)
-                // Simpler approach: GetGameObject() is a member on Component; use scene lookup from that GameObject.
                 auto *owner = GetGameObject();
-                if (owner)
+                auto *target = GetFollowTarget();
+                if (!target && owner && owner->GetScene())
+                {
+                    // The handle outlived its GameObject; drop it instead of resolving it every frame
+                    std::cerr << "Camera on '" << owner->GetName() << "': follow target " << m_followTargetID << " no longer exists" << std::endl;
+                    ClearFollowTarget();
+                }
+                else if (target && owner)
                 {
-                    auto *scene = owner->GetScene();
-                    if (scene)
+                    if (auto *t = target->GetTransform())
                     {
-                        if (auto *target = scene->GetGameObject(m_followTargetID))
+                        glm::vec3 p = t->GetWorldPosition();
+                        // Set camera's GameObject transform to target (preserve Z offset of camera)
+                        if (auto *camTr = owner->GetTransform())
                         {
-                            if (auto *t = target->GetTransform())
+                            glm::vec3 camPos = camTr->GetWorldPosition();
+                            // Untouched when the target is still, so the view stays cached
+                            if (camPos.x != p.x || camPos.y != p.y)
                             {
-                                glm::vec3 p = t->GetPosition();
-                                // Set camera's GameObject transform to target (preserve Z offset of camera)
-                                if (auto *camTr = owner->GetTransform())
-                                {
-                                    glm::vec3 camPos = camTr->GetPosition();
-                                    camPos.x = p.x;
-                                    camPos.y = p.y;
-                                    camTr->SetPosition(camPos);
-                                    InvalidateView();
-                                }
+                                camPos.x = p.x;
+                                camPos.y = p.y;
+                                camTr->SetWorldPosition(camPos);
                             }
                         }
                     }
                 }
             }
 
-            GLint vp[4] = {0, 0, 0, 0};
-            glGetIntegerv(GL_VIEWPORT, vp);
+            int vp[4] = {0, 0, 0, 0};
+            RenderState::GetViewport(vp);
             static int lastW = -1, lastH = -1;
             if (vp[2] != lastW || vp[3] != lastH)
             {
@@ -4,6 +4,7 @@
 #include "Core/Physics2D.hpp"
 #include "Core/Transform.hpp"
 #include "Graphics/SpriteRenderer.hpp"
+#include <cmath>
 
 namespace Kiaak
 {
@@ -48,7 +49,7 @@ namespace Kiaak
             {
                 if (auto *t = go->GetTransform())
                 {
-                    auto p = t->GetPosition();
+                    auto p = t->GetWorldPosition();
                     return glm::vec2(p.x, p.y) + m_offset;
                 }
             }
@@ -56,10 +57,27 @@ namespace Kiaak
         }
         void Collider2D::GetAABB(glm::vec2 &outMin, glm::vec2 &outMax) const
         {
-            glm::vec2 c = GetWorldCenter();
-            glm::vec2 h = GetSize() * 0.5f;
-            outMin = c - h;
-            outMax = c + h;
+            // Physics asks for every pair; only colliders that moved recompute
+            const GameObject *go = GetGameObject();
+            const Transform *t = go ? go->GetTransform() : nullptr;
+            const uint32_t version = t ? t->GetVersion() : 0;
+            if (version == 0 || version != m_aabbVersion)
+            {
+                glm::vec2 c = GetWorldCenter();
+                glm::vec2 h = GetSize() * 0.5f;
+                if (m_useWorldTransform && t)
+                {
+                    // Extent of the transformed box: |M| * half, as for sprites
+                    const Affine2D &world = t->GetWorldAffine();
+                    h = glm::vec2(std::fabs(world.cols[0].x) * h.x + std::fabs(world.cols[1].x) * h.y,
+                                  std::fabs(world.cols[0].y) * h.x + std::fabs(world.cols[1].y) * h.y);
+                }
+                m_aabbMin = c - h;
+                m_aabbMax = c + h;
+                m_aabbVersion = version;
+            }
+            outMin = m_aabbMin;
+            outMax = m_aabbMax;
         }
         void BoxCollider2D::Start()
         {
@@ -72,6 +90,7 @@ namespace Kiaak
                 }
                 if (m_size == glm::vec2(0.0f))
                     m_size = glm::vec2(1.0f);
+                InvalidateAABB();
             }
             Collider2D::Start();
         }
@@ -0,0 +1,76 @@
+#include "Core/CommandBuffer.hpp"
+#include "Core/Scene.hpp"
+#include <iostream>
+
+namespace Kiaak
+{
+    namespace Core
+    {
+
+        namespace
+        {
+            // Bounds chains of commands that keep recording new ones while being applied
+            constexpr int kMaxPlaybackPasses = 8;
+        }
+
+        GameObject *CommandBuffer::Resolve(Scene &scene, uint32_t id)
+        {
+            return scene.GetGameObject(id);
+        }
+
+        void CommandBuffer::CreateGameObject(const std::string &name, Setup setup)
+        {
+            m_commands.push_back([name, setup = std::move(setup)](Scene &scene)
+                                 {
+                                     GameObject *go = scene.CreateGameObject(name);
+                                     if (go && setup)
+                                         setup(*go); });
+        }
+
+        void CommandBuffer::DestroyGameObject(uint32_t id)
+        {
+            if (id != 0)
+                m_destroys.push_back(id);
+        }
+
+        void CommandBuffer::SetParent(uint32_t childId, uint32_t parentId)
+        {
+            m_commands.push_back([childId, parentId](Scene &scene)
+                                 {
+                                     GameObject *child = scene.GetGameObject(childId);
+                                     if (!child)
+                                         return;
+                                     GameObject *parent = parentId != 0 ? scene.GetGameObject(parentId) : nullptr;
+                                     if (parentId != 0 && !parent)
+                                         return; // parent is gone; leave the child where it is
+                                     child->SetParent(parent); });
+        }
+
+        void CommandBuffer::Playback(Scene &scene)
+        {
+            for (int pass = 0; pass < kMaxPlaybackPasses && !IsEmpty(); ++pass)
+            {
+                // Swap out first: applying may record more commands
+                std::vector<std::function<void(Scene &)>> commands;
+                commands.swap(m_commands);
+                for (auto &command : commands)
+                    command(scene);
+                if (!m_commands.empty())
+                    continue; // destroy only once creation has settled
+
+                std::vector<uint32_t> destroys;
+                destroys.swap(m_destroys);
+                scene.RemoveGameObjects(destroys);
+            }
+            if (!IsEmpty())
+                std::cerr << "CommandBuffer: " << GetCommandCount() << " commands deferred to the next sync point" << std::endl;
+        }
+
+        void CommandBuffer::Clear()
+        {
+            m_commands.clear();
+            m_destroys.clear();
+        }
+
+    } // namespace Core
+} // namespace Kiaak
@@ -0,0 +1,94 @@
+#include "Core/ComponentPool.hpp"
+#include <algorithm>
+
+namespace Kiaak
+{
+    namespace Core
+    {
+
+        namespace
+        {
+            constexpr size_t kFirstChunkBlocks = 16;
+            constexpr size_t kMaxChunkBlocks = 4096;
+        }
+
+        std::vector<ComponentPoolBase *> &ComponentPoolBase::Registry()
+        {
+            static std::vector<ComponentPoolBase *> pools;
+            return pools;
+        }
+
+        ComponentPoolBase::ComponentPoolBase(size_t size, size_t alignment)
+        {
+            // Every block must hold a free-list link and keep the type's alignment
+            const size_t align = std::max(alignment, alignof(FreeBlock));
+            m_blockSize = (std::max(size, sizeof(FreeBlock)) + align - 1) / align * align;
+            Registry().push_back(this);
+        }
+
+        ComponentPoolBase::~ComponentPoolBase()
+        {
+            auto &pools = Registry();
+            pools.erase(std::remove(pools.begin(), pools.end(), this), pools.end());
+            // Components still alive at exit keep their memory rather than dangle
+            if (m_live > 0)
+            {
+                for (auto &chunk : m_chunks)
+                    chunk.release();
+            }
+        }
+
+        void ComponentPoolBase::Grow(size_t blocks)
+        {
+            std::unique_ptr<unsigned char[]> chunk(new unsigned char[blocks * m_blockSize]);
+            // Thread the new blocks onto the free list in address order
+            for (size_t i = blocks; i-- > 0;)
+            {
+                auto *block = reinterpret_cast<FreeBlock *>(chunk.get() + i * m_blockSize);
+                block->next = m_free;
+                m_free = block;
+            }
+            m_chunks.push_back(std::move(chunk));
+            m_capacity += blocks;
+        }
+
+        void *ComponentPoolBase::Allocate()
+        {
+            if (!m_free)
+                Grow(std::min(kMaxChunkBlocks, std::max(kFirstChunkBlocks, m_capacity)));
+            FreeBlock *block = m_free;
+            m_free = block->next;
+            m_live++;
+            return block;
+        }
+
+        void ComponentPoolBase::Free(void *block)
+        {
+            auto *freed = static_cast<FreeBlock *>(block);
+            freed->next = m_free;
+            m_free = freed;
+            m_live--;
+        }
+
+        void ComponentPoolBase::Reserve(size_t count)
+        {
+            if (count > m_capacity)
+                Grow(count - m_capacity);
+        }
+
+        std::vector<ComponentPoolBase::Stats> ComponentPoolBase::GetAllStats()
+        {
+            std::vector<Stats> stats;
+            for (const auto *pool : Registry())
+            {
+                if (pool->m_capacity == 0)
+                    continue;
+                stats.push_back({pool->m_typeName, pool->m_live, pool->m_capacity, pool->m_blockSize, pool->m_chunks.size()});
+            }
+            std::sort(stats.begin(), stats.end(), [](const Stats &a, const Stats &b)
+                      { return a.live > b.live; });
+            return stats;
+        }
+
+    } // namespace Core
+} // namespace Kiaak
@@ -0,0 +1,132 @@
+#include "Core/ComponentRegistry.hpp"
+#include <algorithm>
+
+namespace Kiaak
+{
+    namespace Core
+    {
+
+        namespace
+        {
+            constexpr uint32_t kNotRegistered = UINT32_MAX;
+            // Holes tolerated before a set is compacted (and never more than half of it)
+            constexpr size_t kMinHolesToCompact = 32;
+        }
+
+        ComponentRegistry::IterationScope::~IterationScope()
+        {
+            if (--m_registry.m_iterating == 0 && m_registry.m_compactPending)
+                m_registry.Compact();
+        }
+
+        ComponentRegistry::ComponentRegistry()
+        {
+            for (int i = 0; i < kUpdatePhaseCount; ++i)
+                m_phases[i].m_phase = i;
+        }
+
+        uint32_t &ComponentRegistry::IndexIn(Component *component, const Set &set)
+        {
+            return set.m_phase < 0 ? component->m_registryIndex : component->m_phaseIndex[set.m_phase];
+        }
+
+        void ComponentRegistry::Add(Component *component)
+        {
+            if (!component || component->m_registryIndex != kNotRegistered)
+                return;
+            if (component->m_typeId == kInvalidComponentType)
+                return;
+            if (component->m_typeId >= m_sets.size())
+                m_sets.resize(ComponentTypes::Count());
+            AddTo(m_sets[component->m_typeId], component);
+
+            const uint32_t phases = component->GetUpdatePhases();
+            if (phases & kPhaseUpdate)
+                AddTo(m_phases[PhaseSlot(kPhaseUpdate)], component);
+            if (phases & kPhaseFixedUpdate)
+                AddTo(m_phases[PhaseSlot(kPhaseFixedUpdate)], component);
+        }
+
+        void ComponentRegistry::AddTo(Set &set, Component *component)
+        {
+            IndexIn(component, set) = static_cast<uint32_t>(set.m_dense.size());
+            set.m_dense.push_back(component);
+        }
+
+        void ComponentRegistry::Remove(Component *component)
+        {
+            if (!component || component->m_registryIndex == kNotRegistered)
+                return;
+            for (Set &phase : m_phases)
+                RemoveFrom(phase, component);
+            if (component->m_typeId < m_sets.size())
+                RemoveFrom(m_sets[component->m_typeId], component);
+            component->m_registryIndex = kNotRegistered;
+        }
+
+        void ComponentRegistry::RemoveFrom(Set &set, Component *component)
+        {
+            uint32_t &index = IndexIn(component, set);
+            if (index == kNotRegistered)
+                return;
+            if (index < set.m_dense.size() && set.m_dense[index] == component)
+            {
+                // Leave a hole: later slots keep their position (and their order)
+                set.m_dense[index] = nullptr;
+                set.m_holes++;
+            }
+            index = kNotRegistered;
+
+            if (set.m_holes >= kMinHolesToCompact && set.m_holes * 2 >= set.m_dense.size())
+            {
+                if (m_iterating > 0)
+                    m_compactPending = true;
+                else
+                    CompactSet(set);
+            }
+        }
+
+        void ComponentRegistry::CompactSet(Set &set)
+        {
+            if (set.m_holes == 0)
+                return;
+            set.m_dense.erase(std::remove(set.m_dense.begin(), set.m_dense.end(), nullptr), set.m_dense.end());
+            for (size_t i = 0; i < set.m_dense.size(); ++i)
+                IndexIn(set.m_dense[i], set) = static_cast<uint32_t>(i);
+            set.m_holes = 0;
+        }
+
+        void ComponentRegistry::Compact()
+        {
+            if (m_iterating > 0)
+            {
+                m_compactPending = true;
+                return;
+            }
+            for (Set &set : m_sets)
+                CompactSet(set);
+            for (Set &phase : m_phases)
+                CompactSet(phase);
+            m_compactPending = false;
+        }
+
+        void ComponentRegistry::Clear()
+        {
+            for (Set &set : m_sets)
+                for (Component *component : set.m_dense)
+                    if (component)
+                        component->m_registryIndex = kNotRegistered;
+            for (Set &phase : m_phases)
+            {
+                for (Component *component : phase.m_dense)
+                    if (component)
+                        component->m_phaseIndex[phase.m_phase] = kNotRegistered;
+                phase.m_dense.clear();
+                phase.m_holes = 0;
+            }
+            m_sets.clear();
+            m_compactPending = false;
+        }
+
+    } // namespace Core
+} // namespace Kiaak
@@ -0,0 +1,56 @@
+#include "Core/ComponentType.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+namespace Kiaak
+{
+    namespace Core
+    {
+
+        std::deque<ComponentTypes::TypeInfo> &ComponentTypes::Types()
+        {
+            static std::deque<TypeInfo> types;
+            return types;
+        }
+
+        ComponentTypeId ComponentTypes::Register(ComponentTypeId super)
+        {
+            auto &types = Types();
+            if (types.size() >= kInvalidComponentType)
+            {
+                std::cerr << "ComponentTypes: too many component types" << std::endl;
+                std::abort();
+            }
+            const auto id = static_cast<ComponentTypeId>(types.size());
+            types.emplace_back();
+            TypeInfo &info = types.back();
+            info.lineage.push_back(id);
+            if (super != kInvalidComponentType)
+            {
+                const auto &bases = types[super].lineage;
+                info.lineage.insert(info.lineage.end(), bases.begin(), bases.end());
+            }
+            // Views over a base pick up the new type's set through its derived list
+            for (ComponentTypeId type : info.lineage)
+                types[type].derived.push_back(id);
+            return id;
+        }
+
+        bool ComponentTypes::IsA(ComponentTypeId type, ComponentTypeId base)
+        {
+            if (type == base)
+                return true;
+            if (type >= Count() || base >= Count())
+                return false;
+            const auto &lineage = Info(type).lineage;
+            return std::find(lineage.begin() + 1, lineage.end(), base) != lineage.end();
+        }
+
+        size_t ComponentTypes::Count()
+        {
+            return Types().size();
+        }
+
+    } // namespace Core
+} // namespace Kiaak
@@ -1,15 +1,15 @@
 #include "Core/GameObject.hpp"
+#include "Core/Scene.hpp"
 #include <algorithm>
+#include <iostream>
 
 namespace Kiaak
 {
     namespace Core
     {
 
-        uint32_t GameObject::s_nextID = 1;
-
         GameObject::GameObject(const std::string &name)
-            : m_name(name), m_id(s_nextID++)
+            : m_name(name)
         {
 
             // Every GameObject must have a Transform component
@@ -19,6 +19,30 @@ namespace Kiaak
         GameObject::~GameObject()
         {
             OnDestroy();
+            RegisterComponents(false);
+        }
+
+        void GameObject::SetScene(Scene *sc)
+        {
+            if (m_scene == sc)
+                return;
+            RegisterComponents(false);
+            m_scene = sc;
+            RegisterComponents(true);
+        }
+
+        void GameObject::RegisterComponents(bool add)
+        {
+            if (!m_scene)
+                return;
+            auto &registry = m_scene->GetComponentRegistry();
+            for (auto &component : m_components)
+            {
+                if (add)
+                    registry.Add(component.get());
+                else
+                    registry.Remove(component.get());
+            }
         }
 
         void GameObject::Start()
@@ -72,64 +96,94 @@ namespace Kiaak
             }
         }
 
-        void GameObject::SetParent(GameObject *newParent)
+        void GameObject::SetParent(GameObject *newParent, bool keepWorldTransform)
         {
             if (m_parent == newParent)
                 return;
+            for (GameObject *p = newParent; p; p = p->m_parent)
+            {
+                if (p == this)
+                {
+                    std::cerr << "GameObject: cannot parent '" << m_name << "' under its own descendant" << std::endl;
+                    return;
+                }
+            }
+
+            glm::vec3 worldPosition(0.0f), worldScale(1.0f);
+            float worldRotationZ = 0.0f;
+            if (m_transform && keepWorldTransform)
+            {
+                worldPosition = m_transform->GetWorldPosition();
+                worldRotationZ = m_transform->GetWorldRotationZ();
+                worldScale = m_transform->GetWorldScale();
+            }
+
             if (m_parent)
             {
-                RemoveChild(this); // remove from old parent list
+                auto &siblings = m_parent->m_children;
+                siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
             }
             m_parent = newParent;
             if (m_parent)
+                m_parent->m_children.push_back(this);
+
+            if (m_transform)
             {
-                m_parent->AddChild(this);
+                m_transform->MarkWorldDirty();
+                if (keepWorldTransform)
+                {
+                    // Re-express the old world values relative to the new parent
+                    m_transform->SetWorldScale(worldScale);
+                    m_transform->SetWorldRotationZ(worldRotationZ);
+                    m_transform->SetWorldPosition(worldPosition);
+                }
             }
         }
 
         void GameObject::AddChild(GameObject *child)
         {
-            if (!child)
-                return;
-            if (std::find(m_children.begin(), m_children.end(), child) == m_children.end())
-            {
-                m_children.push_back(child);
-                if (child->GetParent() != this)
-                {
-                    child->m_parent = this; // direct set to avoid recursion
-                }
-            }
+            if (child && child != this)
+                child->SetParent(this);
         }
 
         void GameObject::RemoveChild(GameObject *child)
         {
-            if (!child)
-                return;
-            m_children.erase(std::remove(m_children.begin(), m_children.end(), child), m_children.end());
-            if (child->GetParent() == this)
-            {
-                child->m_parent = nullptr;
-            }
+            if (child && child->m_parent == this)
+                child->SetParent(nullptr);
         }
 
-        void GameObject::AddComponentInternal(std::unique_ptr<Component> component)
+        void GameObject::AddComponentInternal(ComponentPtr component)
         {
             Component *componentPtr = component.get();
             componentPtr->m_gameObject = this;
 
-            // Add to type map for fast lookup
-            m_componentMap[std::type_index(typeid(*componentPtr))] = componentPtr;
+            // Index under its type and every component base for O(1) lookup
+            IndexComponent(componentPtr);
 
             // Store the component
             m_components.push_back(std::move(component));
+            if (m_scene)
+            {
+                m_scene->GetComponentRegistry().Add(componentPtr);
+                m_scene->InvalidateBounds(this);
+            }
 
             // Special handling for Transform
-            if (auto *transform = dynamic_cast<Transform *>(componentPtr))
+            if (m_transform == nullptr && componentPtr->m_typeId == ComponentTypes::Id<Transform>())
             {
-                if (m_transform == nullptr)
-                {
-                    m_transform = transform;
-                }
+                m_transform = static_cast<Transform *>(componentPtr);
+            }
+        }
+
+        void GameObject::IndexComponent(Component *component)
+        {
+            for (ComponentTypeId id : ComponentTypes::Lineage(component->m_typeId))
+            {
+                if (id >= m_byType.size())
+                    m_byType.resize(ComponentTypes::Count(), nullptr);
+                // The first component of a type keeps answering GetComponent<T>
+                if (!m_byType[id])
+                    m_byType[id] = component;
             }
         }
 
@@ -148,7 +202,7 @@ namespace Kiaak
         bool GameObject::RemoveComponent(const std::string &typeName)
         {
             auto it = std::find_if(m_components.begin(), m_components.end(),
-                                   [&typeName](const std::unique_ptr<Component> &component)
+                                   [&typeName](const ComponentPtr &component)
                                    {
                                        return component->GetTypeName() == typeName;
                                    });
@@ -163,17 +217,41 @@ namespace Kiaak
                     return false;
                 }
 
-                // Remove from type map
-                m_componentMap.erase(std::type_index(typeid(*component)));
-
-                // Remove from vector
-                m_components.erase(it);
-
+                RemoveComponentInternal(component);
                 return true;
             }
             return false;
         }
 
+        void GameObject::RemoveComponentInternal(Component *component)
+        {
+            if (m_scene)
+            {
+                m_scene->GetComponentRegistry().Remove(component);
+                m_scene->InvalidateBounds(this);
+            }
+
+            // Drop it from the type table before it is destroyed
+            for (auto &slot : m_byType)
+            {
+                if (slot == component)
+                    slot = nullptr;
+            }
+
+            // Remove from vector
+            m_components.erase(
+                std::remove_if(m_components.begin(), m_components.end(),
+                               [component](const ComponentPtr &ptr)
+                               {
+                                   return ptr.get() == component;
+                               }),
+                m_components.end());
+
+            // Hand its type slots to the next component of the same (or a derived) type
+            for (auto &remaining : m_components)
+                IndexComponent(remaining.get());
+        }
+
         std::vector<Component *> GameObject::GetAllComponents()
         {
             std::vector<Component *> result;
@@ -191,7 +269,7 @@ namespace Kiaak
         {
             // Keep only the Transform component
             auto it = std::find_if(m_components.begin(), m_components.end(),
-                                   [this](const std::unique_ptr<Component> &component)
+                                   [this](const ComponentPtr &component)
                                    {
                                        return component.get() == m_transform;
                                    });
@@ -199,11 +277,18 @@ namespace Kiaak
             if (it != m_components.end())
             {
                 auto transform = std::move(*it);
+                if (m_scene)
+                {
+                    for (auto &component : m_components)
+                        if (component)
+                            m_scene->GetComponentRegistry().Remove(component.get());
+                    m_scene->InvalidateBounds(this);
+                }
                 m_components.clear();
-                m_componentMap.clear();
+                m_byType.assign(m_byType.size(), nullptr);
 
                 // Re-add the Transform
-                m_componentMap[std::type_index(typeid(Transform))] = transform.get();
+                IndexComponent(transform.get());
                 m_components.push_back(std::move(transform));
             }
         }
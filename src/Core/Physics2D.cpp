@@ -4,6 +4,7 @@
 #include "Core/Collider2D.hpp"
 #include "Core/GameObject.hpp"
 #include "Core/Transform.hpp"
+#include "Graphics/DebugDraw.hpp"
 #include <algorithm>
 #include <iostream>
 
@@ -12,8 +13,22 @@ namespace Kiaak
     namespace Core
     {
 
+        bool Physics2D::s_debugDraw = false;
+
         Physics2D::Physics2D() : m_gravity(0.0f, -9.81f) {}
 
+        void Physics2D::DrawDebug() const
+        {
+            const glm::vec4 pointColor(1.0f, 0.2f, 0.2f, 1.0f);
+            const glm::vec4 normalColor(0.2f, 0.6f, 1.0f, 1.0f);
+            for (const auto &ct : m_contacts)
+            {
+                DebugDraw::FilledRect(ct.point, glm::vec2(0.06f), pointColor);
+                if (ct.normal != glm::vec2(0.0f))
+                    DebugDraw::Line(ct.point, ct.point + ct.normal * (0.25f + ct.penetration), normalColor);
+            }
+        }
+
         void Physics2D::RegisterBody(Rigidbody2D *rb)
         {
             if (!rb)
@@ -101,10 +116,10 @@ namespace Kiaak
                     {
                         if (auto *t = go->GetTransform())
                         {
-                            glm::vec3 p = t->GetPosition();
+                            glm::vec3 p = t->GetWorldPosition();
                             p.x += vel.x * fdt;
                             p.y += vel.y * fdt;
-                            t->SetPosition(p);
+                            t->SetWorldPosition(p);
                         }
                     }
                 }
@@ -116,10 +131,10 @@ namespace Kiaak
                     {
                         if (auto *t = go->GetTransform())
                         {
-                            glm::vec3 p = t->GetPosition();
+                            glm::vec3 p = t->GetWorldPosition();
                             p.x += vel.x * fdt;
                             p.y += vel.y * fdt;
-                            t->SetPosition(p);
+                            t->SetWorldPosition(p);
                         }
                     }
                 }
@@ -264,10 +279,10 @@ namespace Kiaak
                             if (auto *go = col->GetGameObject())
                                 if (auto *t = go->GetTransform())
                                 {
-                                    auto p = t->GetPosition();
+                                    auto p = t->GetWorldPosition();
                                     p.x += normal.x * penetration * scale;
                                     p.y += normal.y * penetration * scale;
-                                    t->SetPosition(p);
+                                    t->SetWorldPosition(p);
                                 }
                         };
 
@@ -0,0 +1,247 @@
+#include "Core/Profiler.hpp"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Kiaak
+{
+
+    static constexpr int kCpuCount = static_cast<int>(Profiler::CpuStage::Count);
+    static constexpr int kGpuCount = static_cast<int>(Profiler::GpuStage::Count);
+
+    Profiler::Clock::time_point Profiler::s_frameStart;
+    Profiler::Clock::time_point Profiler::s_cpuStart[kCpuCount];
+    Profiler::History Profiler::s_cpuFrame;
+    Profiler::History Profiler::s_cpu[kCpuCount];
+    float Profiler::s_cpuAccum[kCpuCount] = {};
+
+    Profiler::GpuSlot Profiler::s_gpuSlots[kGpuLatency];
+    int Profiler::s_gpuSlot = 0;
+    bool Profiler::s_gpuReady = false;
+    bool Profiler::s_gpuActive = false;
+    Profiler::History Profiler::s_gpuFrame;
+    Profiler::History Profiler::s_gpu[kGpuCount];
+
+    bool Profiler::s_overlayVisible = false;
+
+    // ----- History -----
+
+    void Profiler::History::Push(float ms)
+    {
+        m_samples[m_head] = ms;
+        m_head = (m_head + 1) % kHistorySize;
+        if (m_count < kHistorySize)
+            ++m_count;
+    }
+
+    float Profiler::History::Last() const
+    {
+        if (m_count == 0)
+            return 0.0f;
+        return m_samples[(m_head + kHistorySize - 1) % kHistorySize];
+    }
+
+    float Profiler::History::Average() const
+    {
+        if (m_count == 0)
+            return 0.0f;
+        float sum = 0.0f;
+        for (int i = 0; i < m_count; ++i)
+            sum += m_samples[i];
+        return sum / static_cast<float>(m_count);
+    }
+
+    float Profiler::History::Percentile(float p) const
+    {
+        if (m_count == 0)
+            return 0.0f;
+        std::vector<float> sorted(m_samples, m_samples + m_count);
+        // Nearest-rank on the current window
+        int rank = static_cast<int>(std::ceil(std::min(std::max(p, 0.0f), 1.0f) * m_count)) - 1;
+        rank = std::max(rank, 0);
+        std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+        return sorted[rank];
+    }
+
+    const std::vector<float> &Profiler::History::Values() const
+    {
+        m_ordered.clear();
+        const int start = (m_count < kHistorySize) ? 0 : m_head;
+        for (int i = 0; i < m_count; ++i)
+            m_ordered.push_back(m_samples[(start + i) % kHistorySize]);
+        return m_ordered;
+    }
+
+    // ----- CPU -----
+
+    static float MillisecondsSince(std::chrono::high_resolution_clock::time_point start)
+    {
+        return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    void Profiler::BeginFrame()
+    {
+        s_frameStart = Clock::now();
+        std::fill(s_cpuAccum, s_cpuAccum + kCpuCount, 0.0f);
+
+        // Read back whatever the GPU has finished, then move to the next query slot
+        if (s_gpuReady)
+        {
+            CollectGpu();
+            s_gpuSlot = (s_gpuSlot + 1) % kGpuLatency;
+            GpuSlot &slot = s_gpuSlots[s_gpuSlot];
+            // Not finished after kGpuLatency frames: drop it rather than block
+            slot.pending = false;
+            std::fill(slot.issued, slot.issued + kGpuCount, false);
+        }
+    }
+
+    void Profiler::EndFrame()
+    {
+        s_cpuFrame.Push(MillisecondsSince(s_frameStart));
+        // Stages may run several times per frame (fixed update), so they are summed
+        for (int i = 0; i < kCpuCount; ++i)
+            s_cpu[i].Push(s_cpuAccum[i]);
+
+        if (s_gpuReady)
+        {
+            GpuSlot &slot = s_gpuSlots[s_gpuSlot];
+            slot.pending = std::any_of(slot.issued, slot.issued + kGpuCount, [](bool b)
+                                       { return b; });
+        }
+    }
+
+    void Profiler::BeginCpu(CpuStage stage)
+    {
+        s_cpuStart[static_cast<int>(stage)] = Clock::now();
+    }
+
+    void Profiler::EndCpu(CpuStage stage)
+    {
+        const int i = static_cast<int>(stage);
+        s_cpuAccum[i] += MillisecondsSince(s_cpuStart[i]);
+    }
+
+    // ----- GPU -----
+
+    bool Profiler::EnsureQueries()
+    {
+        if (s_gpuReady)
+            return true;
+        for (auto &slot : s_gpuSlots)
+            glGenQueries(kGpuCount, slot.queries);
+        s_gpuReady = true;
+        return true;
+    }
+
+    void Profiler::BeginGpu(GpuStage stage)
+    {
+        if (s_gpuActive || !EnsureQueries())
+            return;
+        const int i = static_cast<int>(stage);
+        GpuSlot &slot = s_gpuSlots[s_gpuSlot];
+        if (slot.issued[i])
+            return; // one measurement per stage per frame
+        glBeginQuery(GL_TIME_ELAPSED, slot.queries[i]);
+        slot.issued[i] = true;
+        s_gpuActive = true;
+    }
+
+    void Profiler::EndGpu(GpuStage stage)
+    {
+        (void)stage;
+        if (!s_gpuActive)
+            return;
+        glEndQuery(GL_TIME_ELAPSED);
+        s_gpuActive = false;
+    }
+
+    void Profiler::CollectGpu()
+    {
+        // Oldest first so the history stays in frame order
+        for (int n = 1; n <= kGpuLatency; ++n)
+        {
+            GpuSlot &slot = s_gpuSlots[(s_gpuSlot + n) % kGpuLatency];
+            if (!slot.pending)
+                continue;
+
+            // Results become available in submission order; the last issued query decides
+            int lastIssued = -1;
+            for (int i = 0; i < kGpuCount; ++i)
+                if (slot.issued[i])
+                    lastIssued = i;
+            GLint available = 0;
+            glGetQueryObjectiv(slot.queries[lastIssued], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                break; // later slots cannot be done either
+
+            float total = 0.0f;
+            for (int i = 0; i < kGpuCount; ++i)
+            {
+                float ms = 0.0f;
+                if (slot.issued[i])
+                {
+                    GLuint64 ns = 0;
+                    glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &ns);
+                    ms = static_cast<float>(ns) / 1.0e6f;
+                }
+                s_gpu[i].Push(ms);
+                total += ms;
+            }
+            s_gpuFrame.Push(total);
+            slot.pending = false;
+        }
+    }
+
+    void Profiler::Shutdown()
+    {
+        if (!s_gpuReady)
+            return;
+        if (s_gpuActive)
+            glEndQuery(GL_TIME_ELAPSED);
+        for (auto &slot : s_gpuSlots)
+        {
+            glDeleteQueries(kGpuCount, slot.queries);
+            slot = GpuSlot();
+        }
+        s_gpuReady = false;
+        s_gpuActive = false;
+    }
+
+    // ----- Names -----
+
+    const char *Profiler::GetName(CpuStage stage)
+    {
+        switch (stage)
+        {
+        case CpuStage::Input:
+            return "Input";
+        case CpuStage::FixedUpdate:
+            return "Fixed update";
+        case CpuStage::Update:
+            return "Update";
+        case CpuStage::Render:
+            return "Render";
+        default:
+            return "?";
+        }
+    }
+
+    const char *Profiler::GetName(GpuStage stage)
+    {
+        switch (stage)
+        {
+        case GpuStage::Clear:
+            return "Clear";
+        case GpuStage::Scene:
+            return "Scene (tilemaps + sprites)";
+        case GpuStage::DebugDraw:
+            return "Debug draw";
+        case GpuStage::ImGui:
+            return "ImGui";
+        default:
+            return "?";
+        }
+    }
+
+} // namespace Kiaak
@@ -19,10 +19,6 @@ void Rigidbody2D::Start() {
     }
 }
 
-void Rigidbody2D::FixedUpdate(double /*dt*/) {
-    // Forces accumulated externally are handled by Physics2D::Step (not used yet)
-}
-
 void Rigidbody2D::OnDestroy() {
     if (!m_registered) return;
     if (auto* go = GetGameObject()) {
@@ -38,10 +34,10 @@ void Rigidbody2D::OnDestroy() {
 void Rigidbody2D::Teleport(const glm::vec2& pos, float rotZ) {
     if (auto* go = GetGameObject()) {
         if (auto* t = go->GetTransform()) {
-            glm::vec3 p = t->GetPosition();
+            glm::vec3 p = t->GetWorldPosition();
             p.x = pos.x; p.y = pos.y;
-            t->SetPosition(p);
-            t->SetRotationZ(rotZ);
+            t->SetWorldPosition(p);
+            t->SetWorldRotationZ(rotZ);
         }
     }
 }
@@ -2,6 +2,7 @@
 #include "Graphics/SpriteRenderer.hpp"
 #include "Core/Tilemap.hpp"
 #include "Core/Camera.hpp"
+#include "Graphics/RenderState.hpp"
 #include <algorithm>
 #include <vector>
 #include <iostream>
@@ -11,6 +12,12 @@ namespace Kiaak
     namespace Core
     {
 
+        namespace
+        {
+            // Removed objects tolerated in the iteration order before it is compacted
+            constexpr size_t kMinHolesToCompact = 32;
+        }
+
         Scene::Scene()
         {
             std::cout << "Scene created" << std::endl;
@@ -25,18 +32,39 @@ namespace Kiaak
         // GameObject management
         GameObject *Scene::CreateGameObject(const std::string &name)
         {
+            uint32_t index;
+            if (!m_freeSlots.empty())
+            {
+                index = m_freeSlots.front();
+                m_freeSlots.pop_front();
+            }
+            else if (m_slots.size() <= kHandleIndexMask)
+            {
+                index = static_cast<uint32_t>(m_slots.size());
+                m_slots.emplace_back();
+            }
+            else
+            {
+                std::cerr << "Scene: cannot create '" << name << "', all " << (kHandleIndexMask + 1) << " GameObject slots are in use" << std::endl;
+                return nullptr;
+            }
+
             std::string uniqueName = GenerateUniqueGameObjectName(name);
 
-            auto gameObject = std::make_unique<GameObject>(uniqueName);
-            GameObject *gameObjectPtr = gameObject.get();
+            Slot &slot = m_slots[index];
+            slot.object = std::make_unique<GameObject>(uniqueName);
+            slot.orderIndex = static_cast<uint32_t>(m_order.size());
+            GameObject *gameObjectPtr = slot.object.get();
+            const uint32_t id = (slot.generation << kHandleIndexBits) | index;
+            gameObjectPtr->m_id = id;
             // Set back-pointer to this scene
             gameObjectPtr->SetScene(this);
 
             // Add to storage
-            uint32_t id = gameObjectPtr->GetID();
-            m_gameObjectsById[id] = gameObjectPtr;
+            m_order.push_back(gameObjectPtr);
             m_gameObjectsByName[uniqueName] = gameObjectPtr;
-            m_gameObjects.push_back(std::move(gameObject));
+            // New transforms start out stale
+            OnTransformChanged(gameObjectPtr->GetTransform());
 
             // If scene is already started, start this GameObject
             if (m_started)
@@ -48,6 +76,17 @@ namespace Kiaak
             return gameObjectPtr;
         }
 
+        GameObject *Scene::Resolve(uint32_t id) const
+        {
+            const uint32_t index = id & kHandleIndexMask;
+            if (index >= m_slots.size())
+                return nullptr;
+            const Slot &slot = m_slots[index];
+            if (!slot.object || slot.generation != (id >> kHandleIndexBits))
+                return nullptr;
+            return slot.object.get();
+        }
+
         GameObject *Scene::GetGameObject(const std::string &name)
         {
             auto it = m_gameObjectsByName.find(name);
@@ -56,8 +95,7 @@ namespace Kiaak
 
         GameObject *Scene::GetGameObject(uint32_t id)
         {
-            auto it = m_gameObjectsById.find(id);
-            return (it != m_gameObjectsById.end()) ? it->second : nullptr;
+            return Resolve(id);
         }
 
         bool Scene::RemoveGameObject(const std::string &name)
@@ -72,57 +110,123 @@ namespace Kiaak
 
         bool Scene::RemoveGameObject(uint32_t id)
         {
-            auto it = m_gameObjectsById.find(id);
-            if (it != m_gameObjectsById.end())
+            return RemoveGameObject(Resolve(id));
+        }
+
+        std::unique_ptr<GameObject> Scene::Detach(GameObject *gameObject)
+        {
+            const uint32_t id = gameObject->GetID();
+            Slot &slot = m_slots[id & kHandleIndexMask];
+
+            // If designated camera lives on this GO, clear pointer
+            if (m_designatedCamera && m_designatedCamera->GetGameObject() == gameObject)
             {
-                return RemoveGameObject(it->second);
+                m_designatedCamera = nullptr;
             }
-            return false;
+
+            auto byName = m_gameObjectsByName.find(gameObject->GetName());
+            if (byName != m_gameObjectsByName.end() && byName->second == gameObject)
+                m_gameObjectsByName.erase(byName);
+
+            // Children outlive their parent as roots; nobody keeps a pointer to the removed object
+            gameObject->SetParent(nullptr);
+            auto children = gameObject->GetChildren();
+            for (GameObject *child : children)
+                gameObject->RemoveChild(child);
+
+            // Leave a hole so later objects keep their position (and their order)
+            m_order[slot.orderIndex] = nullptr;
+            m_orderHoles++;
+            if (Transform *transform = gameObject->GetTransform(); transform && transform->m_changeIndex != Transform::kNotListed)
+            {
+                m_changedTransforms[transform->m_changeIndex] = nullptr;
+                transform->m_changeIndex = Transform::kNotListed;
+            }
+            m_spatialIndex.Remove(id);
+
+            // Retire the slot for good once its generation is exhausted rather than let old handles alias
+            std::unique_ptr<GameObject> detached = std::move(slot.object);
+            if (slot.generation < kHandleMaxGeneration)
+            {
+                slot.generation++;
+                m_freeSlots.push_back(id & kHandleIndexMask);
+            }
+            return detached;
         }
 
         bool Scene::RemoveGameObject(GameObject *gameObject)
         {
-            if (!gameObject)
+            if (!gameObject || Resolve(gameObject->GetID()) != gameObject)
                 return false;
 
-            auto it = std::find_if(m_gameObjects.begin(), m_gameObjects.end(),
-                                   [gameObject](const std::unique_ptr<GameObject> &ptr)
-                                   {
-                                       return ptr.get() == gameObject;
-                                   });
+            const uint32_t id = gameObject->GetID();
+            const std::string name = gameObject->GetName();
 
-            if (it != m_gameObjects.end())
-            {
-                uint32_t id = gameObject->GetID();
-                std::string name = gameObject->GetName();
+            // Destroy after the bookkeeping: OnDestroy may remove other objects (e.g. tile colliders)
+            std::unique_ptr<GameObject> removed = Detach(gameObject);
+            removed.reset();
+            CompactOrder();
 
-                // If designated camera lives on this GO, clear pointer
-                if (m_designatedCamera && m_designatedCamera->GetGameObject() == gameObject)
-                {
-                    m_designatedCamera = nullptr;
-                }
+            std::cout << "Removed GameObject '" << name << "' with ID " << id << std::endl;
+            return true;
+        }
 
-                // Remove from maps
-                m_gameObjectsById.erase(id);
-                m_gameObjectsByName.erase(name);
+        size_t Scene::RemoveGameObjects(const std::vector<uint32_t> &ids)
+        {
+            std::vector<std::unique_ptr<GameObject>> removed;
+            removed.reserve(ids.size());
+            for (uint32_t id : ids)
+            {
+                // A handle listed twice no longer resolves the second time
+                if (GameObject *gameObject = Resolve(id))
+                    removed.push_back(Detach(gameObject));
+            }
 
-                // Remove from vector
-                m_gameObjects.erase(it);
+            const size_t count = removed.size();
+            removed.clear();
+            CompactOrder();
 
-                std::cout << "Removed GameObject '" << name << "' with ID " << id << std::endl;
-                return true;
+            if (count > 0)
+            {
+                std::cout << "Removed " << count << " GameObjects" << std::endl;
             }
-
-            return false;
+            return count;
         }
 
         void Scene::ClearAllGameObjects()
         {
-            size_t count = m_gameObjects.size();
-            m_gameObjects.clear();
+            // Detach everything first so objects removed from OnDestroy resolve to nothing
+            std::vector<std::unique_ptr<GameObject>> removed;
+            removed.reserve(GetGameObjectCount());
+            for (GameObject *gameObject : m_order)
+            {
+                if (!gameObject)
+                    continue;
+                const uint32_t index = gameObject->GetID() & kHandleIndexMask;
+                Slot &slot = m_slots[index];
+                removed.push_back(std::move(slot.object));
+                if (slot.generation < kHandleMaxGeneration)
+                {
+                    slot.generation++;
+                    m_freeSlots.push_back(index);
+                }
+            }
+            m_order.clear();
+            m_orderHoles = 0;
+            for (Transform *transform : m_changedTransforms)
+            {
+                if (transform)
+                    transform->m_changeIndex = Transform::kNotListed;
+            }
+            m_changedTransforms.clear();
+            m_spatialIndex.Clear();
+            m_boundsDirty.clear();
             m_gameObjectsByName.clear();
-            m_gameObjectsById.clear();
             m_designatedCamera = nullptr;
+            m_commands.Clear();
+
+            size_t count = removed.size();
+            removed.clear();
 
             if (count > 0)
             {
@@ -130,14 +234,142 @@ namespace Kiaak
             }
         }
 
+        void Scene::CompactOrder()
+        {
+            if (m_iterating > 0)
+                return;
+            // Holes are cheap to skip; only rewrite once they make up half of the array
+            if (m_orderHoles < kMinHolesToCompact || m_orderHoles * 2 < m_order.size())
+                return;
+            m_order.erase(std::remove(m_order.begin(), m_order.end(), nullptr), m_order.end());
+            for (size_t i = 0; i < m_order.size(); ++i)
+                m_slots[m_order[i]->GetID() & kHandleIndexMask].orderIndex = static_cast<uint32_t>(i);
+            m_orderHoles = 0;
+        }
+
+        void Scene::OnTransformChanged(Transform *transform)
+        {
+            if (!transform || transform->m_changeIndex != Transform::kNotListed)
+                return;
+            transform->m_changeIndex = static_cast<uint32_t>(m_changedTransforms.size());
+            m_changedTransforms.push_back(transform);
+        }
+
+        void Scene::UpdateTransforms()
+        {
+            // A stale parent is always listed too; the first child to reach it refreshes it
+            for (Transform *transform : m_changedTransforms)
+            {
+                if (transform)
+                    transform->GetWorldAffine();
+            }
+        }
+
+        void Scene::ClearTransformChanges()
+        {
+            // Anything that went stale again during Render stays for the next frame
+            size_t kept = 0;
+            for (Transform *transform : m_changedTransforms)
+            {
+                if (!transform)
+                    continue;
+                if (transform->m_worldDirty)
+                {
+                    transform->m_changeIndex = static_cast<uint32_t>(kept);
+                    m_changedTransforms[kept++] = transform;
+                }
+                else
+                    transform->m_changeIndex = Transform::kNotListed;
+            }
+            m_changedTransforms.resize(kept);
+        }
+
+        void Scene::InvalidateBounds(GameObject *gameObject)
+        {
+            if (gameObject && gameObject->GetScene() == this)
+                m_boundsDirty.push_back(gameObject->GetID());
+        }
+
+        bool Scene::ComputeBounds(GameObject *gameObject, glm::vec2 &min, glm::vec2 &max) const
+        {
+            bool any = false;
+            auto merge = [&](const glm::vec2 &mn, const glm::vec2 &mx)
+            {
+                min = any ? glm::min(min, mn) : mn;
+                max = any ? glm::max(max, mx) : mx;
+                any = true;
+            };
+            if (auto *spriteRenderer = gameObject->GetComponent<Graphics::SpriteRenderer>())
+            {
+                glm::vec2 mn, mx;
+                spriteRenderer->GetWorldAABB(mn, mx);
+                merge(mn, mx);
+            }
+            if (auto *tilemap = gameObject->GetComponent<Tilemap>())
+            {
+                glm::vec2 mn, mx;
+                tilemap->GetWorldBounds(mn, mx);
+                merge(mn, mx);
+            }
+            return any;
+        }
+
+        void Scene::RefreshBounds(GameObject *gameObject, bool force)
+        {
+            const uint32_t id = gameObject->GetID();
+            const uint32_t version = gameObject->GetTransform()->GetVersion();
+            if (!force && m_spatialIndex.GetStamp(id) == version)
+                return;
+            glm::vec2 min, max;
+            if (ComputeBounds(gameObject, min, max))
+                m_spatialIndex.Update(id, min, max, version);
+            else
+                m_spatialIndex.Remove(id);
+        }
+
+        void Scene::RefreshSpatialIndex()
+        {
+            // Only what moved since the last frame, plus explicit invalidations
+            for (Transform *transform : m_changedTransforms)
+            {
+                if (transform)
+                    RefreshBounds(transform->GetGameObject(), false);
+            }
+            for (uint32_t id : m_boundsDirty)
+            {
+                if (GameObject *gameObject = Resolve(id))
+                    RefreshBounds(gameObject, true);
+            }
+            m_boundsDirty.clear();
+        }
+
+        void Scene::FindObjectsInRect(const glm::vec2 &min, const glm::vec2 &max, std::vector<GameObject *> &out)
+        {
+            RefreshSpatialIndex();
+            std::vector<uint32_t> ids;
+            m_spatialIndex.QueryRect(min, max, ids);
+            for (uint32_t id : ids)
+                out.push_back(Resolve(id));
+        }
+
+        void Scene::FindObjectsInRadius(const glm::vec2 &center, float radius, std::vector<GameObject *> &out)
+        {
+            RefreshSpatialIndex();
+            std::vector<uint32_t> ids;
+            m_spatialIndex.QueryRadius(center, radius, ids);
+            for (uint32_t id : ids)
+                out.push_back(Resolve(id));
+        }
+
         std::vector<GameObject *> Scene::GetAllGameObjects()
         {
             std::vector<GameObject *> result;
-            result.reserve(m_gameObjects.size());
+            result.reserve(GetGameObjectCount());
 
-            for (auto &gameObject : m_gameObjects)
+            for (GameObject *gameObject : m_order)
             {
-                result.push_back(gameObject.get());
+                if (gameObject)
+                    result.push_back(gameObject);
             }
 
             return result;
@@ -147,11 +379,11 @@ namespace Kiaak
         {
             std::vector<GameObject *> result;
 
-            for (auto &gameObject : m_gameObjects)
+            for (GameObject *gameObject : m_order)
             {
-                if (gameObject->GetName() == name)
+                if (gameObject && gameObject->GetName() == name)
                 {
-                    result.push_back(gameObject.get());
+                    result.push_back(gameObject);
                 }
             }
 
@@ -160,7 +392,7 @@ namespace Kiaak
 
         size_t Scene::GetGameObjectCount() const
         {
-            return m_gameObjects.size();
+            return m_order.size() - m_orderHoles;
         }
 
         // Scene lifecycle
@@ -171,24 +403,32 @@ namespace Kiaak
 
             // Use index-based loop so GameObjects created during Start (e.g. Tilemap spawning collider children)
             // are also started safely without invalidating iterators.
-            for (size_t i = 0; i < m_gameObjects.size(); ++i)
+            m_iterating++;
+            for (size_t i = 0; i < m_order.size(); ++i)
             {
-                auto &gameObject = m_gameObjects[i];
+                GameObject *gameObject = m_order[i];
                 if (gameObject && gameObject->IsActive())
                     gameObject->Start();
             }
+            m_iterating--;
+            CompactOrder();
 
             m_started = true;
-            std::cout << "Scene started with " << m_gameObjects.size() << " GameObjects" << std::endl;
+            std::cout << "Scene started with " << GetGameObjectCount() << " GameObjects" << std::endl;
         }
 
         void Scene::Update(double deltaTime)
         {
-            for (auto &gameObject : m_gameObjects)
+            // Only components that declared kPhaseUpdate; ones added during the loop run next frame
+            ComponentRegistry::IterationScope scope(m_componentRegistry);
+            const auto &phase = m_componentRegistry.GetPhase(kPhaseUpdate);
+            const size_t count = phase.Size();
+            for (size_t i = 0; i < count; ++i)
             {
-                if (gameObject->IsActive())
+                Component *component = phase.At(i);
+                if (component && component->IsEnabled() && component->GetGameObject()->IsActive())
                 {
-                    gameObject->Update(deltaTime);
+                    component->Update(deltaTime);
                 }
             }
         }
@@ -198,62 +438,250 @@ namespace Kiaak
             // Step physics only when requested (play mode)
             if (runPhysics)
                 m_physics2D.Step(fixedDeltaTime);
-            for (auto &gameObject : m_gameObjects)
+            ComponentRegistry::IterationScope scope(m_componentRegistry);
+            const auto &phase = m_componentRegistry.GetPhase(kPhaseFixedUpdate);
+            const size_t count = phase.Size();
+            for (size_t i = 0; i < count; ++i)
             {
-                if (gameObject->IsActive())
+                Component *component = phase.At(i);
+                if (component && component->IsEnabled() && component->GetGameObject()->IsActive())
                 {
-                    gameObject->FixedUpdate(fixedDeltaTime);
+                    component->FixedUpdate(fixedDeltaTime);
                 }
             }
         }
 
+        namespace
+        {
+            // FNV-1a over raw bytes; only used to notice that static content changed
+            void HashBytes(uint64_t &h, const void *data, size_t size)
+            {
+                const auto *p = static_cast<const unsigned char *>(data);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    h ^= p[i];
+                    h *= 1099511628211ull;
+                }
+            }
+
+            template <typename T>
+            void Hash(uint64_t &h, const T &value)
+            {
+                HashBytes(h, &value, sizeof(T));
+            }
+        }
+
+        void Scene::SetStaticLayersEnabled(bool enabled)
+        {
+            m_staticLayersEnabled = enabled;
+            if (!enabled)
+                m_staticBatches.clear();
+        }
+
+        void Scene::InvalidateStaticLayers()
+        {
+            for (auto &entry : m_staticBatches)
+                if (entry.second.layer)
+                    entry.second.layer->Invalidate();
+        }
+
         void Scene::Render(bool includeDisabledForEditor)
         {
-            // Gather active game objects
-            std::vector<GameObject *> renderList;
-            renderList.reserve(m_gameObjects.size());
-            for (auto &go : m_gameObjects)
+            using Graphics::RenderQueue;
+            static constexpr uint8_t kGhost = 1; // disabled sprite drawn translucent for the editor
+
+            UpdateTransforms();
+
+            // Cull against the active camera's view rectangle
+            m_cullingStats = CullingStats{};
+            Camera *cam = Camera::GetActive();
+            glm::vec2 viewMin(0.0f), viewMax(0.0f);
+            if (cam)
+                cam->GetWorldBounds(viewMin, viewMax);
+
+            const uint32_t tilemapShader = Tilemap::GetSharedShader() ? Tilemap::GetSharedShader()->GetID() : 0;
+            Shader *spriteShaderPtr = Graphics::SpriteRenderer::GetSharedShader();
+            const uint32_t spriteShader = spriteShaderPtr ? spriteShaderPtr->GetID() : 0;
+
+            // Static content needs a camera to cache against; legacy sprite shaders
+            // build their own view-projection and can't be redirected into the cache
+            const bool useStatic = m_staticLayersEnabled && cam;
+            const bool staticSprites = useStatic && spriteShaderPtr && spriteShaderPtr->UsesCameraBlock();
+            for (auto &entry : m_staticBatches)
             {
-                if (go->IsActive())
-                    renderList.push_back(go.get());
+                entry.second.tilemaps.clear();
+                entry.second.sprites.clear();
+                entry.second.hash = 14695981039346656037ull;
             }
 
-            // Sort by Transform Z (ascending) so higher Z draws later (on top)
-            std::stable_sort(renderList.begin(), renderList.end(), [](GameObject *a, GameObject *b)
-                             {
-                                 float za = 0.0f, zb = 0.0f;
-                                 if (auto *ta = a->GetTransform())
-                                     za = ta->GetPosition().z;
-                                 if (auto *tb = b->GetTransform())
-                                     zb = tb->GetPosition().z;
-                                 return za < zb; // painter's algorithm: back (low z) first
-                             });
+            // Gather visible renderables straight from the per-type component arrays;
+            // no per-object lookups and nothing inside the sort
+            m_renderQueue.Clear();
+            for (Tilemap *tilemap : View<Tilemap>())
+            {
+                GameObject *go = tilemap->GetGameObject();
+                if (!go->IsActive() || !tilemap->IsEnabled())
+                    continue;
+                const Transform *tr = go->GetTransform();
+                const float z = tr->GetWorldPosition().z;
+
+                if (useStatic && tilemap->IsStatic())
+                {
+                    StaticBatch &batch = m_staticBatches[z];
+                    batch.tilemaps.push_back(tilemap);
+                    Hash(batch.hash, tilemap);
+                    Hash(batch.hash, tilemap->GetRevision());
+                    Hash(batch.hash, tilemap->GetTexture());
+                    Hash(batch.hash, tilemap->GetTexture() && tilemap->GetTexture()->IsPending()); // changes once an async load lands
+                    Hash(batch.hash, tr->GetWorldAffine()); // includes parent motion, rotation and scale
+                    continue;
+                }
+                uint32_t visible = (uint32_t)tilemap->GetChunkCount();
+                if (cam)
+                {
+                    int cx0, cy0, cx1, cy1;
+                    visible = 0;
+                    if (tilemap->GetVisibleChunkRange(viewMin, viewMax, cx0, cy0, cx1, cy1))
+                        visible = (uint32_t)((cx1 - cx0 + 1) * (cy1 - cy0 + 1));
+                }
+                m_cullingStats.chunksVisible += visible;
+                m_cullingStats.chunksCulled += (uint32_t)tilemap->GetChunkCount() - visible;
+                if (visible > 0)
+                {
+                    uint32_t tex = tilemap->GetTexture() ? tilemap->GetTexture()->GetID() : 0;
+                    m_renderQueue.Push(RenderQueue::Kind::Tilemap, tilemap, RenderQueue::kLayerWorld, z, tilemapShader, tex);
+                }
+            }
 
-            for (auto *gameObject : renderList)
+            for (Graphics::SpriteRenderer *spriteRenderer : View<Graphics::SpriteRenderer>())
             {
-                if (auto *tilemap = gameObject->GetComponent<Tilemap>())
+                GameObject *go = spriteRenderer->GetGameObject();
+                if (!go->IsActive())
+                    continue;
+                if (!spriteRenderer->IsEnabled() && !includeDisabledForEditor)
+                    continue;
+                spriteRenderer->ApplyTextureSize();
+                const Transform *tr = go->GetTransform();
+                const float z = tr->GetWorldPosition().z;
+                if (staticSprites && spriteRenderer->IsStatic() && spriteRenderer->IsEnabled())
                 {
-                    if (tilemap->IsEnabled())
-                        tilemap->Render();
+                    // Culled per strip when the cache is drawn
+                    StaticBatch &batch = m_staticBatches[z];
+                    batch.sprites.push_back(spriteRenderer);
+                    Hash(batch.hash, spriteRenderer);
+                    // Not the GL ID: it changes when the memory budget evicts and reloads a texture
+                    Hash(batch.hash, spriteRenderer->GetTexture());
+                    Hash(batch.hash, spriteRenderer->GetTexture() && spriteRenderer->GetTexture()->IsPending());
+                    Hash(batch.hash, spriteRenderer->IsVisible());
+                    Hash(batch.hash, spriteRenderer->GetColor());
+                    Hash(batch.hash, spriteRenderer->GetSize());
+                    Hash(batch.hash, spriteRenderer->GetUVRect());
+                    Hash(batch.hash, tr->GetWorldAffine()); // includes parent motion
+                    continue;
                 }
-                if (auto *spriteRenderer = gameObject->GetComponent<Graphics::SpriteRenderer>())
+                if (cam)
                 {
-                    if (spriteRenderer->IsEnabled())
+                    glm::vec2 mn, mx;
+                    spriteRenderer->GetWorldAABB(mn, mx);
+                    if (mx.x < viewMin.x || mn.x > viewMax.x || mx.y < viewMin.y || mn.y > viewMax.y)
                     {
-                        spriteRenderer->Render();
+                        m_cullingStats.spritesCulled++;
+                        continue;
                     }
-                    else if (includeDisabledForEditor)
+                }
+                m_cullingStats.spritesVisible++;
+                uint32_t tex = spriteRenderer->GetTexture() ? spriteRenderer->GetTexture()->GetID() : 0;
+                m_renderQueue.Push(RenderQueue::Kind::Sprite, spriteRenderer, RenderQueue::kLayerWorld, z, spriteShader, tex,
+                                   spriteRenderer->IsEnabled() ? 0 : kGhost);
+            }
+
+            // Refresh the caches (off-screen) and queue each layer as one item
+            const int viewportW = RenderState::GetViewportWidth();
+            const int viewportH = RenderState::GetViewportHeight();
+            for (auto it = m_staticBatches.begin(); it != m_staticBatches.end();)
+            {
+                StaticBatch &batch = it->second;
+                if (batch.tilemaps.empty() && batch.sprites.empty())
+                {
+                    it = m_staticBatches.erase(it); // nothing static left at this depth
+                    continue;
+                }
+                if (!batch.layer)
+                    batch.layer = std::make_unique<Graphics::StaticLayer>(it->first);
+
+                auto draw = [&batch](const glm::vec2 &mn, const glm::vec2 &mx)
+                {
+                    for (auto *tilemap : batch.tilemaps)
+                        tilemap->Render(mn, mx);
+                    for (auto *spriteRenderer : batch.sprites)
                     {
-                        bool prevVisible = spriteRenderer->IsVisible();
-                        glm::vec4 prevColor = spriteRenderer->GetColor();
-                        const_cast<Graphics::SpriteRenderer *>(spriteRenderer)->SetVisible(true);
-                        const_cast<Graphics::SpriteRenderer *>(spriteRenderer)->SetColor(prevColor * glm::vec4(1.0f, 1.0f, 1.0f, 0.35f));
+                        glm::vec2 smn, smx;
+                        spriteRenderer->GetWorldAABB(smn, smx);
+                        if (smx.x < mn.x || smn.x > mx.x || smx.y < mn.y || smn.y > mx.y)
+                            continue;
                         spriteRenderer->Render();
-                        const_cast<Graphics::SpriteRenderer *>(spriteRenderer)->SetColor(prevColor);
-                        const_cast<Graphics::SpriteRenderer *>(spriteRenderer)->SetVisible(prevVisible);
                     }
+                };
+
+                if (batch.layer->Update(viewMin, viewMax, viewportW, viewportH, batch.hash, draw))
+                {
+                    m_cullingStats.staticLayers++;
+                    m_cullingStats.staticRedraws += (uint32_t)batch.layer->GetLastRedrawCount();
+                    m_renderQueue.Push(RenderQueue::Kind::StaticLayer, batch.layer.get(), RenderQueue::kLayerWorld, it->first, 0, 0);
+                }
+                else
+                {
+                    // No cache available: draw the content directly like any other item
+                    for (auto *tilemap : batch.tilemaps)
+                        m_renderQueue.Push(RenderQueue::Kind::Tilemap, tilemap, RenderQueue::kLayerWorld, it->first, tilemapShader,
+                                           tilemap->GetTexture() ? tilemap->GetTexture()->GetID() : 0);
+                    for (auto *spriteRenderer : batch.sprites)
+                        m_renderQueue.Push(RenderQueue::Kind::Sprite, spriteRenderer, RenderQueue::kLayerWorld, it->first, spriteShader,
+                                           spriteRenderer->GetTexture() ? spriteRenderer->GetTexture()->GetID() : 0);
+                }
+                ++it;
+            }
+
+            // Painter's algorithm: back (low z) first; equal z groups by shader/texture
+            m_renderQueue.Sort();
+
+            for (const auto &item : m_renderQueue.GetItems())
+            {
+                if (item.kind == RenderQueue::Kind::StaticLayer)
+                {
+                    static_cast<Graphics::StaticLayer *>(item.renderable)->Composite();
+                    continue;
+                }
+                if (item.kind == RenderQueue::Kind::Tilemap)
+                {
+                    auto *tilemap = static_cast<Tilemap *>(item.renderable);
+                    if (cam)
+                        tilemap->Render(viewMin, viewMax);
+                    else
+                        tilemap->Render();
+                    continue;
+                }
+
+                auto *spriteRenderer = static_cast<Graphics::SpriteRenderer *>(item.renderable);
+                if (item.flags & kGhost)
+                {
+                    bool prevVisible = spriteRenderer->IsVisible();
+                    glm::vec4 prevColor = spriteRenderer->GetColor();
+                    spriteRenderer->SetVisible(true);
+                    spriteRenderer->SetColor(prevColor * glm::vec4(1.0f, 1.0f, 1.0f, 0.35f));
+                    spriteRenderer->Render();
+                    spriteRenderer->SetColor(prevColor);
+                    spriteRenderer->SetVisible(prevVisible);
+                }
+                else
+                {
+                    spriteRenderer->Render();
                 }
             }
+
+            // End of the scene's frame: everything has seen this frame's transform changes
+            RefreshSpatialIndex();
+            ClearTransformChanges();
         }
 
         std::string Scene::GenerateUniqueGameObjectName(const std::string &baseName) const
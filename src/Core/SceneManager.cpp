@@ -1,4 +1,5 @@
 #include "Core/SceneManager.hpp"
+#include "Graphics/TextureCache.hpp"
 #include <iostream>
 
 namespace Kiaak
@@ -64,6 +65,7 @@ namespace Kiaak
 
             m_scenes.erase(sceneName);
             std::cout << "Unloaded scene: " << sceneName << std::endl;
+            TextureCache::EvictUnused();
             return true;
         }
 
@@ -82,6 +84,8 @@ namespace Kiaak
                 // Ensure scene Start called only once; rely on Scene::Start internal guard.
                 m_currentScene->Start();
             }
+            // Textures no loaded scene references anymore
+            TextureCache::EvictUnused();
             return true;
         }
 
@@ -127,6 +131,7 @@ namespace Kiaak
             }
             m_scenes.erase(sceneName);
             std::cout << "Unloaded scene: " << sceneName << std::endl;
+            TextureCache::EvictUnused();
             return true;
         }
 
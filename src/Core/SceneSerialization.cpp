@@ -112,6 +112,15 @@ namespace Kiaak::Core
             for (size_t i = 0; i < cols.size(); ++i)
                 out << (int)cols[i] << (i + 1 < cols.size() ? ' ' : '\n');
         }
+        {
+            // Static flags on their own line; older loaders just skip the token
+            auto *sr = go->GetComponent<Graphics::SpriteRenderer>();
+            auto *tm = go->GetComponent<Tilemap>();
+            const bool spriteStatic = sr && sr->IsStatic();
+            const bool tilemapStatic = tm && tm->IsStatic();
+            if (spriteStatic || tilemapStatic)
+                out << "    STATIC sprite " << (spriteStatic ? 1 : 0) << " tilemap " << (tilemapStatic ? 1 : 0) << "\n";
+        }
         if (auto *sc = go->GetComponent<ScriptComponent>())
         {
             out << "    SCRIPT path " << sc->GetScriptPath() << "\n";
@@ -169,6 +178,8 @@ namespace Kiaak::Core
         std::vector<std::tuple<Scene *, std::string, std::string>> pendingFollowByName;
         std::string line;
         Scene *currentScene = nullptr;
+        // Component lines apply to the most recent GAMEOBJECT (nullptr when it was skipped)
+        GameObject *currentObject = nullptr;
         while (std::getline(in, line))
         {
             Trim(line);
@@ -186,6 +197,7 @@ namespace Kiaak::Core
                     manager->CreateScene(sceneName);
                 manager->SwitchToScene(sceneName);
                 currentScene = manager->GetCurrentScene();
+                currentObject = nullptr;
                 if (currentScene && existed)
                     currentScene->ClearAllGameObjects();
             }
@@ -199,16 +211,16 @@ namespace Kiaak::Core
             {
                 std::string goName;
                 iss >> goName;
+                currentObject = nullptr;
                 if (goName.rfind("EditorCamera", 0) == 0)
                     continue;
-                currentScene->CreateGameObject(goName);
+                currentObject = currentScene->CreateGameObject(goName);
             }
             else if (token == "TILEMAP" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 int w, h;
                 std::string temp;
                 float tw, th;
@@ -227,23 +239,22 @@ namespace Kiaak::Core
             }
             else if (token == "TILEDATA" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 if (auto *tm = go->GetComponent<Tilemap>())
                 {
                     auto &tiles = tm->GetTiles();
                     for (size_t i = 0; i < tiles.size(); ++i)
                         iss >> tiles[i];
+                    tm->MarkAllChunksDirty();
                 }
             }
             else if (token == "TILECOLLIDERS" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 if (auto *tm = go->GetComponent<Tilemap>())
                 {
                     auto &cols = tm->GetColliderFlags();
@@ -270,10 +281,9 @@ namespace Kiaak::Core
             }
             else if (token == "TRANSFORM" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 glm::vec3 pos{}, rot{}, scale{1.0f};
                 std::string lbl;
                 while (iss >> lbl)
@@ -294,10 +304,9 @@ namespace Kiaak::Core
             }
             else if (token == "SPRITE" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 std::string sub;
                 iss >> sub;
                 std::string path;
@@ -311,12 +320,32 @@ namespace Kiaak::Core
                         sr->SetTexture(path);
                 }
             }
+            else if (token == "STATIC" && currentScene)
+            {
+                auto *go = currentObject;
+                if (!go)
+                    continue;
+                std::string lbl;
+                int v = 0;
+                while (iss >> lbl >> v)
+                {
+                    if (lbl == "sprite")
+                    {
+                        if (auto *sr = go->GetComponent<Graphics::SpriteRenderer>())
+                            sr->SetStatic(v != 0);
+                    }
+                    else if (lbl == "tilemap")
+                    {
+                        if (auto *tm = go->GetComponent<Tilemap>())
+                            tm->SetStatic(v != 0);
+                    }
+                }
+            }
             else if (token == "ANIMATOR" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 std::string sub; // expect clipIndex
                 iss >> sub;
                 int idx = -1;
@@ -335,10 +364,9 @@ namespace Kiaak::Core
             }
             else if (token == "SCRIPT" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 std::string lbl;
                 std::string path;
                 while (iss >> lbl)
@@ -357,10 +385,9 @@ namespace Kiaak::Core
             }
             else if (token == "CAMERA" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 float ortho = 10.0f, zoom = 1.0f;
                 std::string lbl;
                 uint32_t parsedFollowID = 0;
@@ -383,18 +410,18 @@ namespace Kiaak::Core
                 {
                     cam->SetOrthographicSize(ortho);
                     cam->SetZoom(zoom);
-                    if (parsedFollowID != 0)
-                        cam->SetFollowTargetByID(parsedFollowID);
-                    else if (!parsedFollowName.empty())
+                    // Saved IDs are handles from a previous session; resolve by name when we have one
+                    if (!parsedFollowName.empty())
                         pendingFollowByName.emplace_back(currentScene, go->GetName(), parsedFollowName);
+                    else if (parsedFollowID != 0)
+                        cam->SetFollowTargetByID(parsedFollowID);
                 }
             }
             else if (token == "RIGIDBODY2D" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 std::string lbl;
                 std::string typeStr = "Dynamic";
                 float mass = 1.0f;
@@ -433,10 +460,9 @@ namespace Kiaak::Core
             }
             else if (token == "COLLIDER2D" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 std::string lbl;
                 std::string typeStr = "Box";
                 glm::vec2 size{1.0f};
@@ -545,6 +571,8 @@ namespace Kiaak::Core
             return false;
         std::string line;
         Scene *currentScene = nullptr;
+        // Component lines apply to the most recent GAMEOBJECT (nullptr when it was skipped)
+        GameObject *currentObject = nullptr;
         std::vector<std::pair<Scene *, std::string>> pendingActive;
         std::vector<std::tuple<Scene *, std::string, std::string>> pendingFollowByName;
         while (std::getline(in, line))
@@ -563,6 +591,7 @@ namespace Kiaak::Core
                     manager->CreateScene(sceneName);
                 manager->SwitchToScene(sceneName);
                 currentScene = manager->GetCurrentScene();
+                currentObject = nullptr;
             }
             else if (token == "ACTIVE_CAMERA" && currentScene)
             {
@@ -574,18 +603,18 @@ namespace Kiaak::Core
             {
                 std::string goName;
                 iss >> goName;
+                currentObject = nullptr;
                 if (goName.rfind("EditorCamera", 0) == 0)
                     continue;
                 if (goName.rfind("TileCollider", 0) == 0)
                     continue; // don't recreate serialized tile colliders
-                currentScene->CreateGameObject(goName);
+                currentObject = currentScene->CreateGameObject(goName);
             }
             else if (token == "TILEMAP" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 int w, h;
                 std::string temp;
                 float tw, th;
@@ -604,23 +633,22 @@ namespace Kiaak::Core
             }
             else if (token == "TILEDATA" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 if (auto *tm = go->GetComponent<Tilemap>())
                 {
                     auto &tiles = tm->GetTiles();
                     for (size_t i = 0; i < tiles.size(); ++i)
                         iss >> tiles[i];
+                    tm->MarkAllChunksDirty();
                 }
             }
             else if (token == "TILECOLLIDERS" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 if (auto *tm = go->GetComponent<Tilemap>())
                 {
                     auto &cols = tm->GetColliderFlags();
@@ -647,10 +675,9 @@ namespace Kiaak::Core
             }
             else if (token == "TRANSFORM" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 glm::vec3 pos{}, rot{}, scale{1.0f};
                 std::string lbl;
                 while (iss >> lbl)
@@ -671,10 +698,9 @@ namespace Kiaak::Core
             }
             else if (token == "SPRITE" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 std::string sub;
                 iss >> sub;
                 std::string path;
@@ -688,12 +714,32 @@ namespace Kiaak::Core
                         sr->SetTexture(path);
                 }
             }
+            else if (token == "STATIC" && currentScene)
+            {
+                auto *go = currentObject;
+                if (!go)
+                    continue;
+                std::string lbl;
+                int v = 0;
+                while (iss >> lbl >> v)
+                {
+                    if (lbl == "sprite")
+                    {
+                        if (auto *sr = go->GetComponent<Graphics::SpriteRenderer>())
+                            sr->SetStatic(v != 0);
+                    }
+                    else if (lbl == "tilemap")
+                    {
+                        if (auto *tm = go->GetComponent<Tilemap>())
+                            tm->SetStatic(v != 0);
+                    }
+                }
+            }
             else if (token == "ANIMATOR" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 std::string sub;
                 iss >> sub;
                 int idx = -1;
@@ -712,10 +758,9 @@ namespace Kiaak::Core
             }
             else if (token == "SCRIPT" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 std::string lbl;
                 std::string path;
                 while (iss >> lbl)
@@ -734,10 +779,9 @@ namespace Kiaak::Core
             }
             else if (token == "CAMERA" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 float ortho = 10.0f, zoom = 1.0f;
                 std::string lbl;
                 uint32_t parsedFollowID = 0;
@@ -760,18 +804,18 @@ namespace Kiaak::Core
                 {
                     cam->SetOrthographicSize(ortho);
                     cam->SetZoom(zoom);
-                    if (parsedFollowID != 0)
-                        cam->SetFollowTargetByID(parsedFollowID);
-                    else if (!parsedFollowName.empty())
+                    // Saved IDs are handles from a previous session; resolve by name when we have one
+                    if (!parsedFollowName.empty())
                         pendingFollowByName.emplace_back(currentScene, go->GetName(), parsedFollowName);
+                    else if (parsedFollowID != 0)
+                        cam->SetFollowTargetByID(parsedFollowID);
                 }
             }
             else if (token == "RIGIDBODY2D" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 std::string lbl;
                 std::string typeStr = "Dynamic";
                 float mass = 1.0f;
@@ -810,10 +854,9 @@ namespace Kiaak::Core
             }
             else if (token == "COLLIDER2D" && currentScene)
             {
-                auto objs = currentScene->GetAllGameObjects();
-                if (objs.empty())
+                auto *go = currentObject;
+                if (!go)
                     continue;
-                auto *go = objs.back();
                 std::string lbl;
                 std::string typeStr = "Box";
                 glm::vec2 size{1.0f};
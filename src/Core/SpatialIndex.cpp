@@ -0,0 +1,211 @@
+#include "Core/SpatialIndex.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Kiaak
+{
+    namespace Core
+    {
+
+        namespace
+        {
+            constexpr float kInitialHalfSize = 64.0f;
+            constexpr float kMaxHalfSize = 1.0e7f; // stop growing; farther boxes share the root
+            constexpr int kMaxDepth = 16;
+
+            int Quadrant(const glm::vec2 &point, const glm::vec2 &center)
+            {
+                return (point.x >= center.x ? 1 : 0) | (point.y >= center.y ? 2 : 0);
+            }
+
+            glm::vec2 QuadrantOffset(int quadrant)
+            {
+                return glm::vec2((quadrant & 1) ? 1.0f : -1.0f, (quadrant & 2) ? 1.0f : -1.0f);
+            }
+        }
+
+        uint32_t SpatialIndex::GetStamp(uint32_t id) const
+        {
+            auto it = m_items.find(id);
+            return it != m_items.end() ? it->second.stamp : 0;
+        }
+
+        void SpatialIndex::Clear()
+        {
+            m_nodes.clear();
+            m_root = -1;
+            m_items.clear();
+        }
+
+        void SpatialIndex::GrowRoot(const glm::vec2 &center, float halfExtent)
+        {
+            if (m_root < 0)
+            {
+                Node root;
+                root.center = glm::vec2(0.0f);
+                root.halfSize = kInitialHalfSize;
+                m_nodes.push_back(std::move(root));
+                m_root = 0;
+            }
+            for (;;)
+            {
+                const Node &root = m_nodes[m_root];
+                const glm::vec2 d = center - root.center;
+                const bool fits = halfExtent <= root.halfSize && std::abs(d.x) <= root.halfSize && std::abs(d.y) <= root.halfSize;
+                if (fits || root.halfSize >= kMaxHalfSize)
+                    return;
+                // Double towards the box; the old root becomes one quadrant of the new one
+                Node grown;
+                grown.center = root.center + glm::vec2(d.x >= 0.0f ? 1.0f : -1.0f, d.y >= 0.0f ? 1.0f : -1.0f) * root.halfSize;
+                grown.halfSize = root.halfSize * 2.0f;
+                grown.count = root.count;
+                grown.children[Quadrant(root.center, grown.center)] = m_root;
+                const int32_t index = static_cast<int32_t>(m_nodes.size());
+                m_nodes[m_root].parent = index;
+                m_nodes.push_back(std::move(grown));
+                m_root = index;
+            }
+        }
+
+        int32_t SpatialIndex::FindNode(const glm::vec2 &center, float halfExtent, bool create)
+        {
+            int32_t index = m_root;
+            // Past the maximum root size: the box's center is outside every child's loose
+            // bounds, so only the root (never culled) can hold it
+            const glm::vec2 d = center - m_nodes[index].center;
+            if (std::abs(d.x) > m_nodes[index].halfSize || std::abs(d.y) > m_nodes[index].halfSize)
+                return index;
+            for (int depth = 0; depth < kMaxDepth && halfExtent <= m_nodes[index].halfSize * 0.5f; ++depth)
+            {
+                const int quadrant = Quadrant(center, m_nodes[index].center);
+                int32_t child = m_nodes[index].children[quadrant];
+                if (child < 0)
+                {
+                    if (!create)
+                        return -1;
+                    Node node;
+                    node.halfSize = m_nodes[index].halfSize * 0.5f;
+                    node.center = m_nodes[index].center + QuadrantOffset(quadrant) * node.halfSize;
+                    node.parent = index;
+                    child = static_cast<int32_t>(m_nodes.size());
+                    m_nodes.push_back(std::move(node)); // invalidates references into m_nodes
+                    m_nodes[index].children[quadrant] = child;
+                }
+                index = child;
+            }
+            return index;
+        }
+
+        void SpatialIndex::Insert(uint32_t id, const glm::vec2 &min, const glm::vec2 &max, uint32_t stamp)
+        {
+            const glm::vec2 center = (min + max) * 0.5f;
+            const float halfExtent = std::max(max.x - min.x, max.y - min.y) * 0.5f;
+            GrowRoot(center, halfExtent);
+            const int32_t index = FindNode(center, halfExtent, true);
+
+            Node &node = m_nodes[index];
+            m_items[id] = Item{index, static_cast<uint32_t>(node.entries.size()), stamp};
+            node.entries.push_back(Entry{min, max, id});
+            for (int32_t n = index; n >= 0; n = m_nodes[n].parent)
+                m_nodes[n].count++;
+        }
+
+        void SpatialIndex::Update(uint32_t id, const glm::vec2 &min, const glm::vec2 &max, uint32_t stamp)
+        {
+            auto it = m_items.find(id);
+            if (it != m_items.end())
+            {
+                // Most moves stay within the same node: just rewrite the box
+                const glm::vec2 center = (min + max) * 0.5f;
+                const float halfExtent = std::max(max.x - min.x, max.y - min.y) * 0.5f;
+                GrowRoot(center, halfExtent);
+                Item &item = it->second;
+                if (FindNode(center, halfExtent, false) == item.node)
+                {
+                    Entry &entry = m_nodes[item.node].entries[item.slot];
+                    entry.min = min;
+                    entry.max = max;
+                    item.stamp = stamp;
+                    return;
+                }
+                Remove(id);
+            }
+            Insert(id, min, max, stamp);
+        }
+
+        void SpatialIndex::Remove(uint32_t id)
+        {
+            auto it = m_items.find(id);
+            if (it == m_items.end())
+                return;
+            const Item item = it->second;
+            m_items.erase(it);
+
+            // Swap-and-pop; the moved entry's item learns its new slot
+            auto &entries = m_nodes[item.node].entries;
+            if (item.slot + 1 != entries.size())
+            {
+                entries[item.slot] = entries.back();
+                m_items[entries[item.slot].id].slot = item.slot;
+            }
+            entries.pop_back();
+            for (int32_t n = item.node; n >= 0; n = m_nodes[n].parent)
+                m_nodes[n].count--;
+        }
+
+        template <typename Overlaps>
+        void SpatialIndex::Query(const glm::vec2 &min, const glm::vec2 &max, const Overlaps &overlaps, std::vector<uint32_t> &out) const
+        {
+            if (m_root < 0)
+                return;
+            // Paths are at most kMaxDepth plus the root growth steps (< 64) long; up to 3 siblings wait per level
+            int32_t stack[4 * (kMaxDepth + 64)];
+            int top = 0;
+            stack[top++] = m_root;
+            while (top > 0)
+            {
+                const int32_t index = stack[--top];
+                const Node &node = m_nodes[index];
+                if (node.count == 0)
+                    continue;
+                // Loose bounds: entries may reach out to twice the node's half size (the root
+                // holds anything too large or too far once it stops growing, so it is never culled)
+                const float loose = node.halfSize * 2.0f;
+                if (index != m_root && (max.x < node.center.x - loose || min.x > node.center.x + loose ||
+                    max.y < node.center.y - loose || min.y > node.center.y + loose))
+                    continue;
+                for (const Entry &entry : node.entries)
+                {
+                    if (overlaps(entry))
+                        out.push_back(entry.id);
+                }
+                for (int32_t child : node.children)
+                {
+                    if (child >= 0)
+                        stack[top++] = child;
+                }
+            }
+        }
+
+        void SpatialIndex::QueryRect(const glm::vec2 &min, const glm::vec2 &max, std::vector<uint32_t> &out) const
+        {
+            Query(min, max, [&](const Entry &entry)
+                  { return entry.min.x <= max.x && entry.max.x >= min.x && entry.min.y <= max.y && entry.max.y >= min.y; },
+                  out);
+        }
+
+        void SpatialIndex::QueryRadius(const glm::vec2 &center, float radius, std::vector<uint32_t> &out) const
+        {
+            const glm::vec2 extent(radius);
+            const float radiusSq = radius * radius;
+            Query(center - extent, center + extent, [&](const Entry &entry)
+                  {
+                      // Distance from the center to the nearest point of the box
+                      const glm::vec2 nearest(std::clamp(center.x, entry.min.x, entry.max.x), std::clamp(center.y, entry.min.y, entry.max.y));
+                      const glm::vec2 d = nearest - center;
+                      return d.x * d.x + d.y * d.y <= radiusSq; },
+                  out);
+        }
+
+    } // namespace Core
+} // namespace Kiaak
@@ -3,18 +3,22 @@
 #include "Core/GameObject.hpp"
 #include "Core/Transform.hpp"
 #include "Core/Camera.hpp"
-#include "Core/Project.hpp"
 #include "Core/Scene.hpp"
 #include "Core/Collider2D.hpp"
+#include "Graphics/RenderState.hpp"
+#include "Graphics/TextureCache.hpp"
 #include <glad/glad.h>
 #include <glm/gtc/matrix_transform.hpp>
-#include <filesystem>
+#include <iterator>
+#include <cmath>
 
 namespace Kiaak::Core
 {
     std::shared_ptr<Kiaak::Shader> Tilemap::s_shader = nullptr;
-    std::shared_ptr<Kiaak::VertexArray> Tilemap::s_vao = nullptr;
-    std::shared_ptr<Kiaak::VertexBuffer> Tilemap::s_vbo = nullptr;
+    Kiaak::UniformHandle Tilemap::s_uModel;
+    Kiaak::UniformHandle Tilemap::s_uTint;
+    Kiaak::UniformHandle Tilemap::s_uTex;
+    Kiaak::UniformHandle Tilemap::s_uPremultiplied;
     int Tilemap::s_instances = 0;
 
     Tilemap::Tilemap()
@@ -22,6 +26,7 @@ namespace Kiaak::Core
     {
         m_tiles.assign(m_width * m_height, -1);
         m_tileColliders.assign(m_hFrames * m_vFrames, 0);
+        ResizeChunks();
         s_instances++;
     }
 
@@ -32,6 +37,10 @@ namespace Kiaak::Core
         m_width = w;
         m_height = h;
         m_tiles.assign(m_width * m_height, -1);
+        ResizeChunks();
+        m_revision++;
+        if (auto *go = GetGameObject(); go && go->GetScene())
+            go->GetScene()->InvalidateBounds(go);
     }
 
     void Tilemap::SetTileSize(float w, float h)
@@ -40,6 +49,9 @@ namespace Kiaak::Core
             m_tileWidth = w;
         if (h > 0)
             m_tileHeight = h;
+        MarkAllChunksDirty();
+        if (auto *go = GetGameObject(); go && go->GetScene())
+            go->GetScene()->InvalidateBounds(go);
     }
 
     void Tilemap::SetTileset(const std::string &path, int hFrames, int vFrames)
@@ -51,13 +63,18 @@ namespace Kiaak::Core
             m_vFrames = vFrames;
         m_tileColliders.assign(m_hFrames * m_vFrames, 0);
         m_texture.reset();
+        MarkAllChunksDirty(); // frame counts feed the baked UVs
     }
 
     void Tilemap::SetTile(int x, int y, int index)
     {
         if (x < 0 || y < 0 || x >= m_width || y >= m_height)
             return;
-        m_tiles[y * m_width + x] = index;
+        int &cell = m_tiles[y * m_width + x];
+        if (cell == index)
+            return;
+        cell = index;
+        MarkChunkDirty(x, y);
     }
 
     int Tilemap::GetTile(int x, int y) const
@@ -88,26 +105,102 @@ namespace Kiaak::Core
             const char *vs = R"(#version 330 core
 layout(location=0) in vec2 aPos;
 layout(location=1) in vec2 aUV;
-uniform mat4 uMVP;
+layout(std140) uniform Camera { mat4 uView; mat4 uProjection; mat4 uViewProjection; vec4 uViewportTime; };
+uniform mat4 uModel;
 out vec2 vUV;
-void main(){gl_Position = uMVP * vec4(aPos,0.0,1.0); vUV=aUV;} )";
+void main(){gl_Position = uViewProjection * uModel * vec4(aPos,0.0,1.0); vUV=aUV;} )";
             const char *fs = R"(#version 330 core
-in vec2 vUV; out vec4 FragColor; uniform sampler2D uTex; uniform vec4 uTint; void main(){ FragColor = texture(uTex,vUV)*uTint; })";
+in vec2 vUV; out vec4 FragColor; uniform sampler2D uTex; uniform vec4 uTint; uniform bool uPremultiplied;
+void main(){ vec4 c = texture(uTex,vUV); if (uPremultiplied && c.a > 0.0) c.rgb /= c.a; FragColor = c*uTint; })";
             s_shader = std::make_shared<Kiaak::Shader>();
             s_shader->LoadFromString(vs, fs);
+            s_uModel = s_shader->GetUniformHandle("uModel");
+            s_uTint = s_shader->GetUniformHandle("uTint");
+            s_uTex = s_shader->GetUniformHandle("uTex");
+            s_uPremultiplied = s_shader->GetUniformHandle("uPremultiplied");
         }
-        if (!s_vao)
+    }
+
+    void Tilemap::ResizeChunks()
+    {
+        m_chunksX = (m_width + kChunkSize - 1) / kChunkSize;
+        m_chunksY = (m_height + kChunkSize - 1) / kChunkSize;
+        m_chunks.clear();
+        m_chunks.resize(m_chunksX * m_chunksY);
+    }
+
+    void Tilemap::MarkChunkDirty(int x, int y)
+    {
+        int cx = x / kChunkSize;
+        int cy = y / kChunkSize;
+        if (cx < 0 || cy < 0 || cx >= m_chunksX || cy >= m_chunksY)
+            return;
+        m_chunks[cy * m_chunksX + cx].dirty = true;
+        m_revision++;
+    }
+
+    void Tilemap::MarkAllChunksDirty()
+    {
+        for (auto &chunk : m_chunks)
+            chunk.dirty = true;
+        m_revision++;
+    }
+
+    void Tilemap::RebuildChunk(int cx, int cy)
+    {
+        Chunk &chunk = m_chunks[cy * m_chunksX + cx];
+        chunk.dirty = false;
+
+        // Vertices are baked in tilemap-local space (pos.xy, uv) so the whole chunk
+        // draws with the tilemap's model matrix alone.
+        std::vector<float> verts;
+        const int x0 = cx * kChunkSize;
+        const int y0 = cy * kChunkSize;
+        const int x1 = std::min(x0 + kChunkSize, m_width);
+        const int y1 = std::min(y0 + kChunkSize, m_height);
+        const float invH = 1.0f / (float)m_hFrames;
+        const float invV = 1.0f / (float)m_vFrames;
+        for (int y = y0; y < y1; ++y)
         {
-            float verts[] = {-0.5f, -0.5f, 0, 0, 0.5f, -0.5f, 1, 0, 0.5f, 0.5f, 1, 1, -0.5f, -0.5f, 0, 0, 0.5f, 0.5f, 1, 1, -0.5f, 0.5f, 0, 1};
-            s_vbo = std::make_shared<Kiaak::VertexBuffer>(verts, sizeof(verts));
-            s_vao = std::make_shared<Kiaak::VertexArray>();
-            s_vao->Bind();
-            s_vbo->Bind();
+            for (int x = x0; x < x1; ++x)
+            {
+                int idx = m_tiles[y * m_width + x];
+                if (idx < 0)
+                    continue;
+                int fx = idx % m_hFrames;
+                int fy = idx / m_hFrames;
+                float u0 = fx * invH;
+                float v0 = fy * invV;
+                float u1 = (fx + 1) * invH;
+                float v1 = (fy + 1) * invV;
+                float px0 = x * m_tileWidth;
+                float py0 = y * m_tileHeight;
+                float px1 = px0 + m_tileWidth;
+                float py1 = py0 + m_tileHeight;
+                const float quad[] = {px0, py0, u0, v0, px1, py0, u1, v0, px1, py1, u1, v1,
+                                      px0, py0, u0, v0, px1, py1, u1, v1, px0, py1, u0, v1};
+                verts.insert(verts.end(), std::begin(quad), std::end(quad));
+            }
+        }
+
+        chunk.vertexCount = (int)(verts.size() / 4);
+        if (chunk.vertexCount == 0)
+            return;
+        if (!chunk.vbo)
+        {
+            chunk.vbo = std::make_unique<Kiaak::VertexBuffer>(verts.data(), (unsigned int)(verts.size() * sizeof(float)));
+            chunk.vao = std::make_unique<Kiaak::VertexArray>();
+            chunk.vao->Bind();
+            chunk.vbo->Bind();
             glEnableVertexAttribArray(0);
             glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void *)0);
             glEnableVertexAttribArray(1);
             glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void *)(2 * sizeof(float)));
-            s_vao->Unbind();
+            chunk.vao->Unbind();
+        }
+        else
+        {
+            chunk.vbo->SetData(verts.data(), (unsigned int)(verts.size() * sizeof(float)));
         }
     }
 
@@ -115,25 +208,9 @@ in vec2 vUV; out vec4 FragColor; uniform sampler2D uTex; uniform vec4 uTint; voi
     {
         if (!m_texturePath.empty() && !m_texture)
         {
-            std::string resolved = m_texturePath;
-            if (!std::filesystem::exists(resolved))
-            {
-                // Try project assets path
-                if (Core::Project::HasPath())
-                {
-                    auto candidate = Core::Project::GetAssetsPath() + "/" + m_texturePath;
-                    if (std::filesystem::exists(candidate))
-                        resolved = candidate;
-                }
-                else
-                {
-                    std::string candidate = std::string("assets/") + m_texturePath;
-                    if (std::filesystem::exists(candidate))
-                        resolved = candidate;
-                }
-            }
-            if (std::filesystem::exists(resolved))
-                m_texture = std::make_shared<Texture>(resolved);
+            // Shared through the cache (resolved against the project assets folder);
+            // draws with the white placeholder until uploaded
+            m_texture = Kiaak::TextureCache::Get(m_texturePath);
         }
         if (!m_texture && !s_shader)
         {
@@ -147,80 +224,124 @@ in vec2 vUV; out vec4 FragColor; uniform sampler2D uTex; uniform vec4 uTint; voi
         RebuildColliders();
     }
 
-    void Tilemap::UpdateUV(float u0, float v0, float u1, float v1)
+    void Tilemap::Render()
     {
-        if (!s_vbo)
-            return;
-        float verts[] = {-0.5f, -0.5f, u0, v0, 0.5f, -0.5f, u1, v0, 0.5f, 0.5f, u1, v1, -0.5f, -0.5f, u0, v0, 0.5f, 0.5f, u1, v1, -0.5f, 0.5f, u0, v1};
-        s_vbo->Bind();
-        s_vbo->SetData(verts, sizeof(verts));
+        DrawChunks(0, 0, m_chunksX - 1, m_chunksY - 1);
     }
 
-    void Tilemap::Render()
+    void Tilemap::Render(const glm::vec2 &viewMin, const glm::vec2 &viewMax)
+    {
+        int cx0, cy0, cx1, cy1;
+        if (GetVisibleChunkRange(viewMin, viewMax, cx0, cy0, cx1, cy1))
+            DrawChunks(cx0, cy0, cx1, cy1);
+    }
+
+    glm::vec2 Tilemap::LocalToWorld(const glm::vec2 &local) const
+    {
+        auto *go = GetGameObject();
+        if (!go || !go->GetTransform())
+            return local;
+        return go->GetTransform()->GetWorldAffine().Apply(local);
+    }
+
+    glm::vec2 Tilemap::WorldToLocal(const glm::vec2 &world) const
+    {
+        auto *go = GetGameObject();
+        if (!go || !go->GetTransform())
+            return world;
+        return go->GetTransform()->GetWorldAffine().Inverse().Apply(world);
+    }
+
+    bool Tilemap::WorldToTile(const glm::vec2 &world, int &tx, int &ty) const
+    {
+        const glm::vec2 local = WorldToLocal(world);
+        tx = (int)std::floor(local.x / m_tileWidth);
+        ty = (int)std::floor(local.y / m_tileHeight);
+        return tx >= 0 && ty >= 0 && tx < m_width && ty < m_height;
+    }
+
+    void Tilemap::GetWorldBounds(glm::vec2 &outMin, glm::vec2 &outMax) const
+    {
+        const glm::vec2 size(m_width * m_tileWidth, m_height * m_tileHeight);
+        const glm::vec2 corners[4] = {LocalToWorld(glm::vec2(0.0f)), LocalToWorld(glm::vec2(size.x, 0.0f)),
+                                      LocalToWorld(glm::vec2(0.0f, size.y)), LocalToWorld(size)};
+        outMin = outMax = corners[0];
+        for (const glm::vec2 &corner : corners)
+        {
+            outMin = glm::min(outMin, corner);
+            outMax = glm::max(outMax, corner);
+        }
+    }
+
+    bool Tilemap::GetVisibleChunkRange(const glm::vec2 &viewMin, const glm::vec2 &viewMax, int &cx0, int &cy0, int &cx1, int &cy1) const
+    {
+        auto *go = GetGameObject();
+        if (!go || !go->GetTransform() || m_chunksX == 0 || m_chunksY == 0)
+            return false;
+        // The view rectangle in map space (a box around it when the map is rotated)
+        const Affine2D toLocal = go->GetTransform()->GetWorldAffine().Inverse();
+        const glm::vec2 corners[4] = {toLocal.Apply(viewMin), toLocal.Apply(glm::vec2(viewMax.x, viewMin.y)),
+                                      toLocal.Apply(glm::vec2(viewMin.x, viewMax.y)), toLocal.Apply(viewMax)};
+        glm::vec2 localMin = corners[0], localMax = corners[0];
+        for (const glm::vec2 &corner : corners)
+        {
+            localMin = glm::min(localMin, corner);
+            localMax = glm::max(localMax, corner);
+        }
+        // Visible tile range in map coordinates, then widened to whole chunks
+        int tx0 = (int)std::floor(localMin.x / m_tileWidth);
+        int ty0 = (int)std::floor(localMin.y / m_tileHeight);
+        int tx1 = (int)std::floor(localMax.x / m_tileWidth);
+        int ty1 = (int)std::floor(localMax.y / m_tileHeight);
+        if (tx1 < 0 || ty1 < 0 || tx0 >= m_width || ty0 >= m_height)
+            return false;
+        cx0 = std::max(tx0, 0) / kChunkSize;
+        cy0 = std::max(ty0, 0) / kChunkSize;
+        cx1 = std::min(tx1, m_width - 1) / kChunkSize;
+        cy1 = std::min(ty1, m_height - 1) / kChunkSize;
+        return true;
+    }
+
+    void Tilemap::DrawChunks(int cx0, int cy0, int cx1, int cy1)
     {
         EnsureResources();
         EnsureTexture();
-        if (!s_shader || !s_vao || !m_texture)
+        if (!s_shader || !m_texture)
             return;
         auto *tr = GetGameObject()->GetTransform();
         if (!tr)
             return;
-        glm::mat4 VP(1.0f);
-        if (auto *cam = Core::Camera::GetActive())
-            VP = cam->GetViewProjection();
-        else
-        {
-            GLint vp[4];
-            glGetIntegerv(GL_VIEWPORT, vp);
-            float w = (float)vp[2];
-            float h = (float)vp[3];
-            VP = glm::ortho(-w * 0.5f, w * 0.5f, -h * 0.5f, h * 0.5f, -1.0f, 1.0f);
-        }
-        glm::vec3 pos = tr->GetPosition();
-        glm::mat4 base = glm::translate(glm::mat4(1.0f), glm::vec3(pos.x, pos.y, pos.z));
-        float texW = (float)m_texture->GetWidth();
-        float texH = (float)m_texture->GetHeight();
-        float frameW = texW / (float)m_hFrames;
-        float frameH = texH / (float)m_vFrames;
+        const glm::mat4 base = tr->GetWorldMatrix();
 
         // Disable depth test so transparent pixels don't occlude background
-        GLboolean depthEnabled = glIsEnabled(GL_DEPTH_TEST);
-        if (depthEnabled)
-            glDisable(GL_DEPTH_TEST);
-        GLboolean depthMask;
-        glGetBooleanv(GL_DEPTH_WRITEMASK, &depthMask);
-        if (depthMask)
-            glDepthMask(GL_FALSE);
-        for (int y = 0; y < m_height; ++y)
+        const bool depthEnabled = RenderState::IsDepthTestEnabled();
+        const bool depthMask = RenderState::IsDepthMaskEnabled();
+        RenderState::SetDepthTest(false);
+        RenderState::SetDepthMask(false);
+
+        // Per-tilemap state is set once; each chunk is then a single draw call
+        s_shader->Use();
+        s_shader->Set(s_uModel, base);
+        s_shader->Set(s_uTint, glm::vec4(1, 1, 1, 1));
+        m_texture->Bind(0);
+        s_shader->Set(s_uTex, 0);
+        s_shader->Set(s_uPremultiplied, m_texture->IsPremultiplied());
+        for (int cy = cy0; cy <= cy1; ++cy)
         {
-            for (int x = 0; x < m_width; ++x)
+            for (int cx = cx0; cx <= cx1; ++cx)
             {
-                int idx = m_tiles[y * m_width + x];
-                if (idx < 0)
+                Chunk &chunk = m_chunks[cy * m_chunksX + cx];
+                if (chunk.dirty)
+                    RebuildChunk(cx, cy);
+                if (chunk.vertexCount == 0 || !chunk.vao)
                     continue;
-                int fx = idx % m_hFrames;
-                int fy = idx / m_hFrames;
-                float u0 = (fx * frameW) / texW;
-                float v0 = (fy * frameH) / texH;
-                float u1 = ((fx + 1) * frameW) / texW;
-                float v1 = ((fy + 1) * frameH) / texH;
-                UpdateUV(u0, v0, u1, v1);
-                glm::mat4 model = glm::translate(base, glm::vec3((x + 0.5f) * m_tileWidth, (y + 0.5f) * m_tileHeight, 0.0f));
-                model = glm::scale(model, glm::vec3(m_tileWidth, m_tileHeight, 1.0f));
-                s_shader->Use();
-                s_shader->SetMat4("uMVP", VP * model);
-                s_shader->SetVec4("uTint", glm::vec4(1, 1, 1, 1));
-                m_texture->Bind(0);
-                s_shader->SetInt("uTex", 0);
-                s_vao->Bind();
-                glDrawArrays(GL_TRIANGLES, 0, 6);
-                s_vao->Unbind();
+                chunk.vao->Bind();
+                glDrawArrays(GL_TRIANGLES, 0, chunk.vertexCount);
             }
         }
-        if (depthMask)
-            glDepthMask(GL_TRUE);
-        if (depthEnabled)
-            glEnable(GL_DEPTH_TEST);
+
+        RenderState::SetDepthMask(depthMask);
+        RenderState::SetDepthTest(depthEnabled);
     }
 
     void Tilemap::RebuildColliders()
@@ -258,10 +379,6 @@ in vec2 vUV; out vec4 FragColor; uniform sampler2D uTex; uniform vec4 uTint; voi
         int frameCount = m_hFrames * m_vFrames;
         if (frameCount <= 0)
             return;
-        auto *tr = go->GetTransform();
-        if (!tr)
-            return;
-        glm::vec3 basePos = tr->GetPosition();
         for (int y = 0; y < m_height; ++y)
         {
             for (int x = 0; x < m_width; ++x)
@@ -274,12 +391,15 @@ in vec2 vUV; out vec4 FragColor; uniform sampler2D uTex; uniform vec4 uTint; voi
                 auto *colGO = scene->CreateGameObject("TileCollider");
                 if (!colGO)
                     continue;
-                colGO->GetTransform()->SetPosition(glm::vec3(basePos.x + (x + 0.5f) * m_tileWidth, basePos.y + (y + 0.5f) * m_tileHeight, basePos.z));
+                // Parented to the tilemap, so the tile center is a local offset and follows the map
+                colGO->SetParent(go, false);
+                colGO->GetTransform()->SetPosition(glm::vec3((x + 0.5f) * m_tileWidth, (y + 0.5f) * m_tileHeight, 0.0f));
                 if (auto *box = colGO->AddComponent<Core::BoxCollider2D>())
                 {
+                    // Tile size is local; the bounds follow the map's scale/rotation like the drawn tiles
                     box->SetSize(glm::vec2(m_tileWidth, m_tileHeight));
+                    box->SetUseWorldTransform(true);
                 }
-                colGO->SetParent(go); // parent under tilemap for hierarchy cleanliness
                 m_colliderObjectIDs.push_back(colGO->GetID());
             }
         }
@@ -1,5 +1,8 @@
 #include "Core/Transform.hpp"
+#include "Core/GameObject.hpp"
+#include "Core/Scene.hpp"
 #include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/euler_angles.hpp>
@@ -7,12 +10,53 @@
 namespace Kiaak {
 namespace Core {
 
-Transform::Transform() 
-    : m_position(0.0f), m_rotation(0.0f), m_scale(1.0f), m_transformMatrix(1.0f) {
+Affine2D Affine2D::operator*(const Affine2D& rhs) const {
+    Affine2D result;
+    result.cols[0] = cols[0] * rhs.cols[0].x + cols[1] * rhs.cols[0].y;
+    result.cols[1] = cols[0] * rhs.cols[1].x + cols[1] * rhs.cols[1].y;
+    result.cols[2] = Apply(rhs.cols[2]);
+    result.depth = depth + rhs.depth;
+    return result;
+}
+
+Affine2D Affine2D::Inverse() const {
+    Affine2D result;
+    const float det = cols[0].x * cols[1].y - cols[1].x * cols[0].y;
+    if (det != 0.0f) {
+        const float inv = 1.0f / det;
+        result.cols[0] = glm::vec2(cols[1].y * inv, -cols[0].y * inv);
+        result.cols[1] = glm::vec2(-cols[1].x * inv, cols[0].x * inv);
+    }
+    // A degenerate (zero scale) transform can only be undone as far as its translation
+    result.cols[2] = -(result.cols[0] * cols[2].x + result.cols[1] * cols[2].y);
+    result.depth = -depth;
+    return result;
+}
+
+glm::mat4 Affine2D::ToMat4() const {
+    glm::mat4 m(1.0f);
+    m[0] = glm::vec4(cols[0], 0.0f, 0.0f);
+    m[1] = glm::vec4(cols[1], 0.0f, 0.0f);
+    m[3] = glm::vec4(cols[2], depth, 1.0f);
+    return m;
+}
+
+Affine2D Affine2D::FromMat4(const glm::mat4& m) {
+    Affine2D result;
+    result.cols[0] = glm::vec2(m[0]);
+    result.cols[1] = glm::vec2(m[1]);
+    result.cols[2] = glm::vec2(m[3]);
+    result.depth = m[3].z;
+    return result;
+}
+
+Transform::Transform()
+    : m_position(0.0f), m_scale(1.0f) {
 }
 
 void Transform::SetPosition(const glm::vec3& position) {
-    m_position = position;
+    m_position = glm::vec2(position);
+    m_depth = position.z;
     MarkMatrixDirty();
 }
 
@@ -21,7 +65,9 @@ void Transform::SetPosition(float x, float y, float z) {
 }
 
 void Transform::SetRotation(const glm::vec3& rotation) {
-    m_rotation = rotation;
+    m_angle = rotation.z;
+    if (m_extra3D || rotation.x != 0.0f || rotation.y != 0.0f)
+        Ensure3D().rotationXY = glm::vec2(rotation);
     MarkMatrixDirty();
 }
 
@@ -30,12 +76,18 @@ void Transform::SetRotation(float x, float y, float z) {
 }
 
 void Transform::SetRotationZ(float angleDegrees) {
-    m_rotation.z = angleDegrees;
+    m_angle = angleDegrees;
     MarkMatrixDirty();
 }
 
+glm::vec3 Transform::GetRotation() const {
+    return m_extra3D ? glm::vec3(m_extra3D->rotationXY, m_angle) : glm::vec3(0.0f, 0.0f, m_angle);
+}
+
 void Transform::SetScale(const glm::vec3& scale) {
-    m_scale = scale;
+    m_scale = glm::vec2(scale);
+    if (m_extra3D || scale.z != 1.0f)
+        Ensure3D().scaleZ = scale.z;
     MarkMatrixDirty();
 }
 
@@ -47,9 +99,12 @@ void Transform::SetScale(float uniformScale) {
     SetScale(glm::vec3(uniformScale));
 }
 
+glm::vec3 Transform::GetScale() const {
+    return glm::vec3(m_scale, m_extra3D ? m_extra3D->scaleZ : 1.0f);
+}
+
 void Transform::Translate(const glm::vec3& translation) {
-    m_position += translation;
-    MarkMatrixDirty();
+    SetPosition(GetPosition() + translation);
 }
 
 void Transform::Translate(float x, float y, float z) {
@@ -57,46 +112,174 @@ void Transform::Translate(float x, float y, float z) {
 }
 
 void Transform::Rotate(const glm::vec3& rotation) {
-    m_rotation += rotation;
-    MarkMatrixDirty();
+    SetRotation(GetRotation() + rotation);
 }
 
 void Transform::RotateZ(float angleDegrees) {
-    m_rotation.z += angleDegrees;
+    m_angle += angleDegrees;
     MarkMatrixDirty();
 }
 
 void Transform::Scale(const glm::vec3& scale) {
-    m_scale *= scale;
-    MarkMatrixDirty();
+    SetScale(GetScale() * scale);
 }
 
 void Transform::Scale(float uniformScale) {
     Scale(glm::vec3(uniformScale));
 }
 
-glm::mat4 Transform::GetTransformMatrix() const {
+bool Transform::HasLocal3D() const {
+    return m_extra3D && (m_extra3D->rotationXY != glm::vec2(0.0f) || m_extra3D->scaleZ != 1.0f);
+}
+
+Transform::Extra3D& Transform::Ensure3D() const {
+    if (!m_extra3D)
+        m_extra3D = std::make_unique<Extra3D>();
+    return *m_extra3D;
+}
+
+void Transform::MarkMatrixDirty() {
+    m_matrixDirty = true;
+    MarkWorldDirty();
+}
+
+void Transform::MarkWorldDirty() {
+    // Already dirty means the whole subtree is too
+    if (m_worldDirty)
+        return;
+    m_worldDirty = true;
+    if (++m_version == 0)
+        m_version = 1;
+    if (auto* go = GetGameObject()) {
+        if (Scene* scene = go->GetScene())
+            scene->OnTransformChanged(this);
+        for (auto* child : go->GetChildren()) {
+            if (auto* t = child->GetTransform())
+                t->MarkWorldDirty();
+        }
+    }
+}
+
+Transform* Transform::GetParent() const {
+    auto* go = GetGameObject();
+    auto* parent = go ? go->GetParent() : nullptr;
+    return parent ? parent->GetTransform() : nullptr;
+}
+
+const Affine2D& Transform::GetWorldAffine() const {
+    if (m_worldDirty) {
+        // A dirty parent would have marked us dirty too; bring it up to date first
+        if (const Transform* parent = GetParent())
+            parent->GetWorldAffine();
+        UpdateWorldMatrix();
+    }
+    return m_worldAffine;
+}
+
+glm::mat4 Transform::GetWorldMatrix() const {
+    const Affine2D& world = GetWorldAffine();
+    return m_world3D ? m_extra3D->world : world.ToMat4();
+}
+
+void Transform::UpdateWorldMatrix() const {
+    if (!m_worldDirty)
+        return;
+    const Transform* parent = GetParent();
+    if (!HasLocal3D() && !(parent && parent->m_world3D)) {
+        const Affine2D& local = GetLocalAffine();
+        m_worldAffine = parent ? parent->m_worldAffine * local : local;
+        m_world3D = false;
+    } else {
+        Extra3D& extra = Ensure3D();
+        const glm::mat4 local = GetTransformMatrix();
+        extra.world = parent ? parent->GetWorldMatrix() * local : local;
+        m_worldAffine = Affine2D::FromMat4(extra.world);
+        m_world3D = true;
+    }
+    m_worldDirty = false;
+}
+
+glm::vec3 Transform::GetWorldPosition() const {
+    const Affine2D& world = GetWorldAffine();
+    return glm::vec3(world.cols[2], world.depth);
+}
+
+void Transform::SetWorldPosition(const glm::vec3& position) {
+    const Transform* parent = GetParent();
+    if (!parent) {
+        SetPosition(position);
+        return;
+    }
+    parent->GetWorldAffine();
+    if (parent->m_world3D) {
+        SetPosition(glm::vec3(glm::inverse(parent->m_extra3D->world) * glm::vec4(position, 1.0f)));
+        return;
+    }
+    const Affine2D inverse = parent->m_worldAffine.Inverse();
+    SetPosition(glm::vec3(inverse.Apply(glm::vec2(position)), position.z + inverse.depth));
+}
+
+float Transform::GetWorldRotationZ() const {
+    const Affine2D& world = GetWorldAffine();
+    return glm::degrees(std::atan2(world.cols[0].y, world.cols[0].x));
+}
+
+void Transform::SetWorldRotationZ(float angleDegrees) {
+    const Transform* parent = GetParent();
+    SetRotationZ(parent ? angleDegrees - parent->GetWorldRotationZ() : angleDegrees);
+}
+
+glm::vec3 Transform::GetWorldScale() const {
+    // Lengths of the basis vectors; sign and shear from non-uniform parents are lost
+    const Affine2D& world = GetWorldAffine();
+    const float z = m_world3D ? glm::length(glm::vec3(m_extra3D->world[2])) : 1.0f;
+    return glm::vec3(glm::length(world.cols[0]), glm::length(world.cols[1]), z);
+}
+
+void Transform::SetWorldScale(const glm::vec3& scale) {
+    const Transform* parent = GetParent();
+    if (!parent) {
+        SetScale(scale);
+        return;
+    }
+    const glm::vec3 parentScale = parent->GetWorldScale();
+    auto divide = [](float a, float b) { return b != 0.0f ? a / b : a; };
+    SetScale(divide(scale.x, parentScale.x), divide(scale.y, parentScale.y), divide(scale.z, parentScale.z));
+}
+
+const Affine2D& Transform::GetLocalAffine() const {
     if (m_matrixDirty) {
-        UpdateMatrix();
+        // Translation * RotationZ * Scale, with one sin/cos per change
+        const float radians = glm::radians(m_angle);
+        const float c = std::cos(radians);
+        const float s = std::sin(radians);
+        m_localAffine.cols[0] = glm::vec2(c, s) * m_scale.x;
+        m_localAffine.cols[1] = glm::vec2(-s, c) * m_scale.y;
+        m_localAffine.cols[2] = m_position;
+        m_localAffine.depth = m_depth;
+        m_matrixDirty = false;
     }
-    return m_transformMatrix;
+    return m_localAffine;
 }
 
-void Transform::UpdateMatrix() const {
+glm::mat4 Transform::GetTransformMatrix() const {
+    if (!HasLocal3D())
+        return GetLocalAffine().ToMat4();
+
     // Create transformation matrix: Translation * Rotation * Scale
-    glm::mat4 translation = glm::translate(glm::mat4(1.0f), m_position);
-    
+    glm::mat4 translation = glm::translate(glm::mat4(1.0f), GetPosition());
+
     // Convert degrees to radians and create rotation matrix
+    const glm::vec3 rotationDegrees = GetRotation();
     glm::mat4 rotation = glm::eulerAngleXYZ(
-        glm::radians(m_rotation.x),
-        glm::radians(m_rotation.y),
-        glm::radians(m_rotation.z)
+        glm::radians(rotationDegrees.x),
+        glm::radians(rotationDegrees.y),
+        glm::radians(rotationDegrees.z)
     );
-    
-    glm::mat4 scale = glm::scale(glm::mat4(1.0f), m_scale);
-    
-    m_transformMatrix = translation * rotation * scale;
-    m_matrixDirty = false;
+
+    glm::mat4 scale = glm::scale(glm::mat4(1.0f), GetScale());
+
+    return translation * rotation * scale;
 }
 
 } // namespace Core
@@ -1,12 +1,13 @@
 #include "Core/Window.hpp"
+#include "Graphics/RenderState.hpp"
 #include <glad/glad.h>
 #include <iostream>
 
 namespace Kiaak
 {
 
-    Window::Window(int width, int height, const std::string &title)
-        : window(nullptr), width(width), height(height), framebufferWidth(width), framebufferHeight(height), title(title) {}
+    Window::Window(int width, int height, const std::string &title, bool headless)
+        : window(nullptr), width(width), height(height), framebufferWidth(width), framebufferHeight(height), title(title), headless(headless) {}
 
     Window::~Window()
     {
@@ -18,23 +19,48 @@ namespace Kiaak
         glfwTerminate();
     }
 
-    bool Window::Initialize()
+    bool Window::CreateNativeWindow()
     {
-        if (!glfwInit())
-        {
-            std::cerr << "Failed to initialize GLFW\n";
-            return false;
-        }
-
         glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
         glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
         glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 #ifdef __APPLE__
         glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
+        if (headless)
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
 
         window = glfwCreateWindow(width, height, title.c_str(), nullptr, nullptr);
-        if (!window)
+        return window != nullptr;
+    }
+
+    bool Window::Initialize()
+    {
+        bool created = glfwInit() && CreateNativeWindow();
+
+#ifdef GLFW_PLATFORM_NULL
+        // No display server (CI/build machines): GLFW's null platform with an
+        // OSMesa or EGL context, e.g. Mesa llvmpipe
+        if (!created && headless)
+        {
+            const int contextApis[] = {GLFW_OSMESA_CONTEXT_API, GLFW_EGL_CONTEXT_API};
+            for (int api : contextApis)
+            {
+                glfwTerminate();
+                glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+                if (!glfwInit())
+                    break;
+                glfwWindowHint(GLFW_CONTEXT_CREATION_API, api);
+                if ((created = CreateNativeWindow()))
+                {
+                    std::cout << "Headless: using " << (api == GLFW_OSMESA_CONTEXT_API ? "OSMesa" : "EGL") << " context\n";
+                    break;
+                }
+            }
+        }
+#endif
+
+        if (!created)
         {
             std::cerr << "Failed to create GLFW window\n";
             glfwTerminate();
@@ -55,7 +81,7 @@ namespace Kiaak
         width = winW;
         height = winH;
         glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
-        glViewport(0, 0, framebufferWidth, framebufferHeight);
+        RenderState::SetViewport(0, 0, framebufferWidth, framebufferHeight);
 
         glfwSetWindowUserPointer(window, this);
 
@@ -70,7 +96,7 @@ namespace Kiaak
         // Framebuffer size callback (pixel size) - update viewport here
         glfwSetFramebufferSizeCallback(window, [](GLFWwindow *win, int fbw, int fbh)
                                        {
-        glViewport(0, 0, fbw, fbh);
+        RenderState::SetViewport(0, 0, fbw, fbh);
         if (auto* self = static_cast<Window*>(glfwGetWindowUserPointer(win))) {
             self->framebufferWidth = fbw;
             self->framebufferHeight = fbh;
@@ -78,8 +104,8 @@ namespace Kiaak
 
         glfwSwapInterval(1); // vsync
 
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        RenderState::SetBlend(true);
+        RenderState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
         return true;
     }
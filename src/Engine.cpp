@@ -5,15 +5,22 @@
 #include "Core/Animator.hpp"
 #include "Core/Rigidbody2D.hpp"
 #include "Core/Collider2D.hpp"
+#include "Core/ComponentPool.hpp"
 #include "Core/Tilemap.hpp"
 #include "Editor/EditorCore.hpp"
 #include "Editor/EditorUI.hpp"
 #include "Core/SceneSerialization.hpp"
 #include "Core/Project.hpp"
+#include "Graphics/DebugDraw.hpp"
+#include "Core/Profiler.hpp"
+#include "Graphics/Texture.hpp"
+#include "Graphics/TextureCache.hpp"
+#include "Graphics/TextureLoader.hpp"
 #include "imgui.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glad/glad.h>
+#include <cstdio>
 #include <iostream>
 #include <vector>
 #include <algorithm>
@@ -35,9 +42,10 @@ namespace Kiaak
     }
 
     // Initialize engine subsystems and load project/scenes
-    bool Engine::Initialize()
+    bool Engine::Initialize(const LaunchOptions &options)
     {
-        window = std::make_unique<Window>(800, 600, "Kiaak Engine");
+        launchOptions = options;
+        window = std::make_unique<Window>(options.width, options.height, "Kiaak Engine", options.headless);
         if (!window->Initialize())
         {
             return false;
@@ -48,11 +56,18 @@ namespace Kiaak
         {
             return false;
         }
+        Texture::SetMemoryBudget(static_cast<size_t>(options.textureBudgetMB) * 1024 * 1024);
 
         timer = std::make_unique<Timer>();
         Input::Initialize(window->GetNativeWindow());
         sceneManager = std::make_unique<Core::SceneManager>();
 
+        if (!options.projectPath.empty())
+        {
+            Core::Project::SetPath(options.projectPath);
+            Core::Project::EnsureStructure();
+        }
+
         if (!Core::Project::HasPath())
         {
             std::ifstream projIn("last_project.txt");
@@ -89,14 +104,22 @@ namespace Kiaak
         {
             sceneManager->CreateScene("MainScene");
         }
+        if (!options.sceneName.empty())
+        {
+            sceneManager->SwitchToScene(options.sceneName);
+        }
         auto *currentScene = sceneManager->GetCurrentScene();
 
         CreateEditorCamera();
 
-        editorCore = std::make_unique<Kiaak::EditorCore>();
-        if (!editorCore->Initialize(window.get(), sceneManager.get(), renderer.get()))
+        // Headless runs (CI, benchmarks, thumbnails) have no one to drive the editor
+        if (!options.headless)
         {
-            return false;
+            editorCore = std::make_unique<Kiaak::EditorCore>();
+            if (!editorCore->Initialize(window.get(), sceneManager.get(), renderer.get()))
+            {
+                return false;
+            }
         }
 
         InitLua();
@@ -107,6 +130,10 @@ namespace Kiaak
         }
 
         SwitchToEditorMode();
+        if (options.headless)
+        {
+            ToggleEditorMode(); // same as pressing Play
+        }
 
         isRunning = true;
         return true;
@@ -128,6 +155,10 @@ namespace Kiaak
                                                   { t.SetPosition(x, y, z); }, "get_position", [](Kiaak::Core::Transform &t)
                                                   {
                                                       auto p = t.GetPosition();
+                                                      return std::vector<float>{p.x, p.y, p.z}; }, "set_world_position", [](Kiaak::Core::Transform &t, float x, float y, float z)
+                                                  { t.SetWorldPosition(glm::vec3(x, y, z)); }, "get_world_position", [](Kiaak::Core::Transform &t)
+                                                  {
+                                                      auto p = t.GetWorldPosition();
                                                       return std::vector<float>{p.x, p.y, p.z}; }, "translate", [](Kiaak::Core::Transform &t, float x, float y, float z)
                                                   { t.Translate(x, y, z); }, "set_rotation_z", [](Kiaak::Core::Transform &t, float deg)
                                                   { t.SetRotationZ(deg); });
@@ -151,6 +182,8 @@ namespace Kiaak
         lua->new_usertype<Kiaak::Graphics::SpriteRenderer>("SpriteRenderer",
                                                            "set_visible", &Kiaak::Graphics::SpriteRenderer::SetVisible,
                                                            "is_visible", &Kiaak::Graphics::SpriteRenderer::IsVisible,
+                                                           "set_static", &Kiaak::Graphics::SpriteRenderer::SetStatic,
+                                                           "is_static", &Kiaak::Graphics::SpriteRenderer::IsStatic,
                                                            "set_texture", [](Kiaak::Graphics::SpriteRenderer &sr, const std::string &path)
                                                            { sr.SetTexture(path); });
 
@@ -191,6 +224,37 @@ namespace Kiaak
         lua->set_function("GetGameObjectByID", [](uint32_t id) -> Kiaak::Core::GameObject *
                           { return Engine::Get()->GetGameObject(id); });
 
+        // Active objects whose sprite/tilemap bounds overlap the area (unordered)
+        lua->set_function("FindObjectsInRect", [](float minX, float minY, float maxX, float maxY)
+                          {
+                              std::vector<Kiaak::Core::GameObject *> found;
+                              if (auto *sc = Engine::Get() ? Engine::Get()->GetCurrentScene() : nullptr)
+                                  sc->FindObjectsInRect(glm::vec2(std::min(minX, maxX), std::min(minY, maxY)),
+                                                        glm::vec2(std::max(minX, maxX), std::max(minY, maxY)), found);
+                              found.erase(std::remove_if(found.begin(), found.end(), [](Kiaak::Core::GameObject *go)
+                                                         { return !go->IsActive(); }),
+                                          found.end());
+                              return found; });
+        lua->set_function("FindObjectsInRadius", [](float x, float y, float radius)
+                          {
+                              std::vector<Kiaak::Core::GameObject *> found;
+                              if (auto *sc = Engine::Get() ? Engine::Get()->GetCurrentScene() : nullptr)
+                                  sc->FindObjectsInRadius(glm::vec2(x, y), radius, found);
+                              found.erase(std::remove_if(found.begin(), found.end(), [](Kiaak::Core::GameObject *go)
+                                                         { return !go->IsActive(); }),
+                                          found.end());
+                              return found; });
+
+        // Deferred: the object is destroyed at the next sync point, after the current update
+        lua->set_function("DestroyGameObject", [](uint32_t id)
+                          {
+                              if (auto *sc = Engine::Get() ? Engine::Get()->GetCurrentScene() : nullptr)
+                                  sc->GetCommands().DestroyGameObject(id); });
+
+        // IDs are generational handles: false once the object was removed, even if its slot is reused
+        lua->set_function("IsGameObjectAlive", [](uint32_t id) -> bool
+                          { return Engine::Get()->GetGameObject(id) != nullptr; });
+
         // High-level movement helpers for convenience in scripts
         lua->set_function("ApplyImpulseTo", [](const std::string &name, float x, float y)
                           {
@@ -338,27 +402,76 @@ namespace Kiaak
                                       return;
                                   }
                               } });
+
+        // Debug drawing (one frame, world space); color defaults to white
+        auto debugColor = [](sol::optional<float> r, sol::optional<float> g, sol::optional<float> b, sol::optional<float> a)
+        { return glm::vec4(r.value_or(1.0f), g.value_or(1.0f), b.value_or(1.0f), a.value_or(1.0f)); };
+        lua->set_function("DebugLine", [debugColor](float x1, float y1, float x2, float y2, sol::optional<float> r, sol::optional<float> g, sol::optional<float> b, sol::optional<float> a)
+                          { DebugDraw::Line(glm::vec2(x1, y1), glm::vec2(x2, y2), debugColor(r, g, b, a)); });
+        lua->set_function("DebugBox", [debugColor](float minX, float minY, float maxX, float maxY, sol::optional<float> r, sol::optional<float> g, sol::optional<float> b, sol::optional<float> a)
+                          { DebugDraw::Box(glm::vec2(minX, minY), glm::vec2(maxX, maxY), debugColor(r, g, b, a)); });
+        lua->set_function("DebugCircle", [debugColor](float x, float y, float radius, sol::optional<float> r, sol::optional<float> g, sol::optional<float> b, sol::optional<float> a)
+                          { DebugDraw::Circle(glm::vec2(x, y), radius, debugColor(r, g, b, a)); });
+        // Drawn with the editor's ImGui overlay (edit and play mode); a no-op in headless runs
+        lua->set_function("DebugText", [debugColor](float x, float y, const std::string &text, sol::optional<float> r, sol::optional<float> g, sol::optional<float> b, sol::optional<float> a)
+                          { DebugDraw::Text(glm::vec2(x, y), text, debugColor(r, g, b, a)); });
+        lua->set_function("SetPhysicsDebugDraw", [](bool enabled)
+                          { Core::Physics2D::SetDebugDrawEnabled(enabled); });
     }
 
     // Main loop: input, update, render, and advance input states
     void Engine::Run()
     {
+        int frame = 0;
         while (isRunning && !window->ShouldClose())
         {
-            window->Update();
+            Profiler::BeginFrame();
 
+            Profiler::BeginCpu(Profiler::CpuStage::Input);
+            window->Update();
             timer->update();
             ProcessInput();
+            Profiler::EndCpu(Profiler::CpuStage::Input);
 
             while (timer->shouldUpdateFixed())
             {
+                Profiler::CpuScope scope(Profiler::CpuStage::FixedUpdate);
                 FixedUpdate(timer->getFixedDeltaTime());
+                // Sync point: apply structural changes recorded during the step
+                if (auto *sc = GetCurrentScene())
+                    sc->ApplyCommands();
             }
 
-            Update(timer->getDeltaTime());
-            Render();
+            {
+                Profiler::CpuScope scope(Profiler::CpuStage::Update);
+                Update(timer->getDeltaTime());
+                // Sync point: nothing is iterating the scene between here and Render
+                if (auto *sc = GetCurrentScene())
+                    sc->ApplyCommands();
+            }
+            {
+                Profiler::CpuScope scope(Profiler::CpuStage::Render);
+                Render();
+            }
             Input::PostFrame();
+            Profiler::EndFrame();
+
+            if (launchOptions.maxFrames > 0 && ++frame >= launchOptions.maxFrames)
+            {
+                // Captures should not show placeholders: give async textures a little longer
+                const int kMaxExtraFrames = 600;
+                if (TextureLoader::GetPendingCount() > 0 && frame < launchOptions.maxFrames + kMaxExtraFrames)
+                    continue;
+                break;
+            }
         }
+
+        if (!launchOptions.capturePath.empty() && renderer && renderer->IsOffscreen())
+            renderer->CaptureFrame(launchOptions.capturePath);
+
+        // No overlay without a window; leave the numbers in the log instead
+        if (launchOptions.headless)
+            PrintProfilerSummary();
     }
 
     // Handle per-frame input
@@ -368,6 +481,10 @@ namespace Kiaak
         {
             isRunning = false;
         }
+        if (Input::IsKeyPressed(GLFW_KEY_F3))
+        {
+            Profiler::ToggleOverlay();
+        }
 
         Input::Update();
     }
@@ -405,10 +522,12 @@ namespace Kiaak
     {
         renderer->BeginFrame(0.2f, 0.2f, 0.2f, 1.0f);
 
+        Profiler::BeginGpu(Profiler::GpuStage::Scene);
         if (auto *sc = GetCurrentScene())
         {
             sc->Render(editorMode); // include disabled components when in editor mode
         }
+        Profiler::EndGpu(Profiler::GpuStage::Scene);
 
         // Draw tilemap grid overlay (editor only)
         if (editorMode)
@@ -416,6 +535,14 @@ namespace Kiaak
             RenderTilemapGrid();
         }
 
+        // Contact points/normals from the last physics step (toggled from Lua)
+        if (Core::Physics2D::IsDebugDrawEnabled())
+        {
+            if (auto *sc = GetCurrentScene())
+                if (auto *phys = sc->GetPhysics2D())
+                    phys->DrawDebug();
+        }
+
         // Draw collider outlines in editor mode
         if (editorMode)
         {
@@ -430,18 +557,8 @@ namespace Kiaak
                             continue;
                         glm::vec2 mn, mx;
                         c->GetAABB(mn, mx);
-                        glm::vec2 size = mx - mn;
-                        glm::vec2 center = (mn + mx) * 0.5f;
-                        float z = 0.0f;
-                        if (auto *go = c->GetGameObject())
-                            if (auto *t = go->GetTransform())
-                                z = t->GetPosition().z + 0.02f;
                         glm::vec4 col = c->IsTrigger() ? glm::vec4(1, 1, 0, 0.6f) : glm::vec4(0, 1, 0, 0.6f);
-                        float thick = 0.01f;
-                        renderer->DrawQuad(glm::vec3(center.x, mx.y + thick * 0.5f, z), glm::vec2(size.x + thick * 2.f, thick), col);
-                        renderer->DrawQuad(glm::vec3(center.x, mn.y - thick * 0.5f, z), glm::vec2(size.x + thick * 2.f, thick), col);
-                        renderer->DrawQuad(glm::vec3(mn.x - thick * 0.5f, center.y, z), glm::vec2(thick, size.y), col);
-                        renderer->DrawQuad(glm::vec3(mx.x + thick * 0.5f, center.y, z), glm::vec2(thick, size.y), col);
+                        DebugDraw::Box(mn, mx, col);
                     }
                 }
             }
@@ -459,16 +576,11 @@ namespace Kiaak
             {
                 if (auto *sc = GetCurrentScene())
                 {
-                    for (auto *go : sc->GetAllGameObjects())
+                    for (Core::Camera *cam : sc->View<Core::Camera>())
                     {
-                        if (!go)
-                            continue;
-                        auto *cam = go->GetComponent<Core::Camera>();
-                        if (!cam)
-                            continue;
-
+                        Core::GameObject *go = cam->GetGameObject();
                         const Core::Transform *t = go->GetTransform();
-                        glm::vec3 camPos = t ? t->GetPosition() : glm::vec3(0.0f);
+                        glm::vec3 camPos = t ? t->GetWorldPosition() : glm::vec3(0.0f);
 
                         float halfH = cam->GetOrthographicSize() / std::max(cam->GetZoom(), 0.0001f);
                         float aspect = 1.0f;
@@ -482,42 +594,32 @@ namespace Kiaak
                         float halfW = halfH * aspect;
 
                         glm::vec4 camColor(1.0f, 1.0f, 1.0f, 0.9f);
-                        float z = camPos.z + 0.05f;
 
                         if (go->GetName() == "EditorCamera")
                             continue;
 
-                        float border = 0.01f;
-                        if (auto *vcam = cam)
-                        {
-
-                            if (window)
-                            {
-                                float visibleH = 2.0f * vcam->GetOrthographicSize() / std::max(vcam->GetZoom(), 0.0001f);
-                                float perPixelY = visibleH / static_cast<float>(window->GetHeight());
-                                border = std::max(perPixelY * 2.0f, perPixelY * 0.5f);
-                            }
-                        }
-
                         glm::vec2 ctr(camPos.x, camPos.y);
-                        float width = halfW * 2.0f;
-                        float height = halfH * 2.0f;
-
                         const float eps = 1e-5f;
-                        if (width > eps && height > eps)
+                        if (halfW > eps && halfH > eps)
                         {
-                            renderer->DrawQuad(glm::vec3(ctr.x, camPos.y + halfH + border * 0.5f, z), glm::vec2(width + border * 2.0f, border), camColor);
-                            renderer->DrawQuad(glm::vec3(ctr.x, camPos.y - halfH - border * 0.5f, z), glm::vec2(width + border * 2.0f, border), camColor);
-                            renderer->DrawQuad(glm::vec3(camPos.x - halfW - border * 0.5f, ctr.y, z), glm::vec2(border, height), camColor);
-                            renderer->DrawQuad(glm::vec3(camPos.x + halfW + border * 0.5f, ctr.y, z), glm::vec2(border, height), camColor);
+                            DebugDraw::Box(ctr - glm::vec2(halfW, halfH), ctr + glm::vec2(halfW, halfH), camColor);
 
                             float iconSize = std::max(0.05f, std::min(halfW, halfH) * 0.12f);
-                            renderer->DrawQuad(glm::vec3(camPos.x, camPos.y, z + 0.02f), glm::vec2(iconSize, iconSize), camColor);
+                            DebugDraw::FilledRect(ctr, glm::vec2(iconSize, iconSize), camColor);
                         }
                     }
                 }
             }
+            // All overlay shapes for this frame are in; draw them in one go
+            Profiler::BeginGpu(Profiler::GpuStage::DebugDraw);
+            DebugDraw::Flush();
+            Profiler::EndGpu(Profiler::GpuStage::DebugDraw);
+            DrawDebugText();
             editorCore->Render();
+            if (Profiler::IsOverlayVisible())
+            {
+                DrawProfilerOverlay();
+            }
             if (editorMode)
             {
                 // Sync engine selection with editor selection
@@ -558,7 +660,16 @@ namespace Kiaak
                     selectedGameObject = editorSel;
                 }
             }
+            Profiler::BeginGpu(Profiler::GpuStage::ImGui);
             EditorUI::EndFrame();
+            Profiler::EndGpu(Profiler::GpuStage::ImGui);
+        }
+        else
+        {
+            Profiler::BeginGpu(Profiler::GpuStage::DebugDraw);
+            DebugDraw::Flush();
+            Profiler::EndGpu(Profiler::GpuStage::DebugDraw);
+            DebugDraw::ClearText(); // headless: no ImGui context to draw text with
         }
 
         renderer->EndFrame();
@@ -648,7 +759,8 @@ namespace Kiaak
     {
         if (isRunning)
         {
-            if (sceneManager && Core::Project::HasPath())
+            // Headless runs must never rewrite the project they were pointed at
+            if (sceneManager && Core::Project::HasPath() && !launchOptions.headless)
             {
                 auto scenesPath = Core::Project::GetScenesPath();
                 std::filesystem::create_directories(scenesPath);
@@ -863,6 +975,33 @@ namespace Kiaak
         // Last resort: keep current active
     }
 
+    void Engine::DrawDebugText()
+    {
+        const auto &markers = DebugDraw::GetTextMarkers();
+        auto *cam = Core::Camera::GetActive();
+        if (markers.empty() || !cam || !window)
+        {
+            DebugDraw::ClearText();
+            return;
+        }
+
+        // World -> NDC -> logical window coords (ImGui space)
+        const glm::mat4 VP = cam->GetViewProjection();
+        const float w = static_cast<float>(window->GetWidth());
+        const float h = static_cast<float>(window->GetHeight());
+        ImDrawList *drawList = ImGui::GetForegroundDrawList();
+        for (const auto &m : markers)
+        {
+            glm::vec4 clip = VP * glm::vec4(m.position, 0.0f, 1.0f);
+            if (clip.w != 0.0f)
+                clip /= clip.w;
+            const float sx = (clip.x * 0.5f + 0.5f) * w;
+            const float sy = (1.0f - (clip.y * 0.5f + 0.5f)) * h;
+            drawList->AddText(ImVec2(sx, sy), ImGui::ColorConvertFloat4ToU32(ImVec4(m.color.x, m.color.y, m.color.z, m.color.w)), m.text.c_str());
+        }
+        DebugDraw::ClearText();
+    }
+
     glm::vec2 Engine::ScreenToWorld(double mouseX, double mouseY, Core::Camera *cam) const
     {
         if (!cam)
@@ -934,70 +1073,69 @@ namespace Kiaak
 
         std::vector<ClickedItem> clickedSprites;
 
-        auto allGameObjects = currentScene->GetAllGameObjects();
-        for (auto *gameObject : allGameObjects)
+        // First, check sprite renderers (the scene's spatial index narrows it to objects under the cursor)
+        std::vector<Core::GameObject *> candidates;
+        currentScene->FindObjectsInRect(worldPos, worldPos, candidates);
+        for (Core::GameObject *gameObject : candidates)
         {
-            if (!gameObject)
-                continue;
-
-            // First, check sprite renderer
             auto *spriteRenderer = gameObject->GetComponent<Graphics::SpriteRenderer>();
-            if (spriteRenderer && spriteRenderer->IsVisible())
-            {
-                auto *transform = gameObject->GetTransform();
-                if (!transform)
-                    continue;
-                glm::vec3 spritePos = transform->GetPosition();
-                glm::vec3 spriteScale = transform->GetScale();
-                glm::vec2 spriteSize = spriteRenderer->GetSize();
-
-                float halfWidth = (spriteSize.x * spriteScale.x) * 0.5f;
-                float halfHeight = (spriteSize.y * spriteScale.y) * 0.5f;
+            if (!spriteRenderer || !spriteRenderer->IsVisible())
+                continue;
+            auto *transform = gameObject->GetTransform();
+            if (!transform)
+                continue;
+            glm::vec3 spritePos = transform->GetWorldPosition();
+            glm::vec2 spriteMin, spriteMax;
+            spriteRenderer->GetWorldAABB(spriteMin, spriteMax);
 
-                float minX = spritePos.x - halfWidth;
-                float maxX = spritePos.x + halfWidth;
-                float minY = spritePos.y - halfHeight;
-                float maxY = spritePos.y + halfHeight;
+            float minX = spriteMin.x;
+            float maxX = spriteMax.x;
+            float minY = spriteMin.y;
+            float maxY = spriteMax.y;
 
-                if (worldPos.x >= minX && worldPos.x <= maxX && worldPos.y >= minY && worldPos.y <= maxY)
-                {
-                    clickedSprites.push_back({gameObject, spriteRenderer, spritePos.z, glm::vec4(minX, minY, maxX, maxY)});
-                    continue; // found sprite hit, prefer it over camera on same object
-                }
+            if (worldPos.x >= minX && worldPos.x <= maxX && worldPos.y >= minY && worldPos.y <= maxY)
+            {
+                clickedSprites.push_back({gameObject, spriteRenderer, spritePos.z, glm::vec4(minX, minY, maxX, maxY)});
             }
+        }
 
-            // Tilemap selection intentionally disabled in scene: can only select via inspector now.
-            // (Previously: tilemap bounds hit-test would add to clickedSprites.)
+        // Tilemap selection intentionally disabled in scene: can only select via inspector now.
+        // (Previously: tilemap bounds hit-test would add to clickedSprites.)
 
-            // Next consider camera components (skip editor camera)
+        // Next consider camera components (skip editor camera)
+        const size_t spriteHits = clickedSprites.size();
+        for (Core::Camera *camComp : currentScene->View<Core::Camera>())
+        {
+            auto *gameObject = camComp->GetGameObject();
             if (gameObject->GetName() == "EditorCamera")
                 continue;
-            auto *camComp = gameObject->GetComponent<Core::Camera>();
-            if (camComp)
+            // A sprite hit on the same object is preferred over its camera
+            auto spriteEnd = clickedSprites.begin() + spriteHits;
+            if (std::any_of(clickedSprites.begin(), spriteEnd, [gameObject](const ClickedItem &item)
+                            { return item.gameObject == gameObject; }))
+                continue;
+            auto *t = gameObject->GetTransform();
+            if (!t)
+                continue;
+            glm::vec3 camPos = t->GetWorldPosition();
+            float halfH = camComp->GetOrthographicSize() / std::max(camComp->GetZoom(), 0.0001f);
+            float aspect = 1.0f;
+            if (window)
             {
-                auto *t = gameObject->GetTransform();
-                if (!t)
-                    continue;
-                glm::vec3 camPos = t->GetPosition();
-                float halfH = camComp->GetOrthographicSize() / std::max(camComp->GetZoom(), 0.0001f);
-                float aspect = 1.0f;
-                if (window)
-                {
-                    float w = static_cast<float>(window->GetFramebufferWidth());
-                    float h = static_cast<float>(window->GetFramebufferHeight());
-                    if (h > 0.0f)
-                        aspect = w / h;
-                }
-                float halfW = halfH * aspect;
-                float minX = camPos.x - halfW;
-                float maxX = camPos.x + halfW;
-                float minY = camPos.y - halfH;
-                float maxY = camPos.y + halfH;
+                float w = static_cast<float>(window->GetFramebufferWidth());
+                float h = static_cast<float>(window->GetFramebufferHeight());
+                if (h > 0.0f)
+                    aspect = w / h;
+            }
+            float halfW = halfH * aspect;
+            float minX = camPos.x - halfW;
+            float maxX = camPos.x + halfW;
+            float minY = camPos.y - halfH;
+            float maxY = camPos.y + halfH;
 
-                if (worldPos.x >= minX && worldPos.x <= maxX && worldPos.y >= minY && worldPos.y <= maxY)
-                {
-                    clickedSprites.push_back({gameObject, nullptr, camPos.z, glm::vec4(minX, minY, maxX, maxY)});
-                }
+            if (worldPos.x >= minX && worldPos.x <= maxX && worldPos.y >= minY && worldPos.y <= maxY)
+            {
+                clickedSprites.push_back({gameObject, nullptr, camPos.z, glm::vec4(minX, minY, maxX, maxY)});
             }
         }
 
@@ -1026,18 +1164,13 @@ namespace Kiaak
             {
                 if (auto *tilemap = selectedGameObject->GetComponent<Core::Tilemap>())
                 {
-                    if (auto *tr = selectedGameObject->GetTransform())
+                    if (selectedGameObject->GetTransform())
                     {
-                        glm::vec3 tp = tr->GetPosition();
-                        float tw = tilemap->GetTileWidth();
-                        float th = tilemap->GetTileHeight();
-                        float w = tilemap->GetWidth() * tw;
-                        float h = tilemap->GetHeight() * th;
-                        float minX = tp.x;
-                        float minY = tp.y;
-                        float maxX = tp.x + w;
-                        float maxY = tp.y + h;
-                        bool insideTilemap = (worldPos.x >= minX && worldPos.x <= maxX && worldPos.y >= minY && worldPos.y <= maxY);
+                        // In map space, so rotated/scaled maps test their actual area
+                        glm::vec2 local = tilemap->WorldToLocal(worldPos);
+                        float w = tilemap->GetWidth() * tilemap->GetTileWidth();
+                        float h = tilemap->GetHeight() * tilemap->GetTileHeight();
+                        bool insideTilemap = (local.x >= 0.0f && local.x <= w && local.y >= 0.0f && local.y <= h);
                         if (insideTilemap)
                         {
                             // Keep selection (allow painting). Do not deselect.
@@ -1081,17 +1214,10 @@ namespace Kiaak
         double mx, my;
         Input::GetMousePosition(mx, my);
         glm::vec2 world = ScreenToWorld(mx, my, cam);
-        auto *tr = selectedGameObject->GetTransform();
-        if (!tr)
-            return;
-        glm::vec3 basePos = tr->GetPosition();
-        float relX = world.x - basePos.x;
-        float relY = world.y - basePos.y;
-        if (relX < 0 || relY < 0)
+        if (!selectedGameObject->GetTransform())
             return;
-        int tx = (int)floor(relX / tilemap->GetTileWidth());
-        int ty = (int)floor(relY / tilemap->GetTileHeight());
-        if (tx < 0 || ty < 0 || tx >= tilemap->GetWidth() || ty >= tilemap->GetHeight())
+        int tx, ty;
+        if (!tilemap->WorldToTile(world, tx, ty))
             return;
         bool lHeld = Input::IsMouseButtonHeld(MouseButton::Left);
         bool rHeld = Input::IsMouseButtonHeld(MouseButton::Right);
@@ -1127,37 +1253,27 @@ namespace Kiaak
         auto *tilemap = selectedGameObject->GetComponent<Core::Tilemap>();
         if (!tilemap)
             return;
-        auto *tr = selectedGameObject->GetTransform();
-        if (!tr)
+        if (!selectedGameObject->GetTransform())
             return;
-        glm::vec3 base = tr->GetPosition();
         int w = tilemap->GetWidth();
         int h = tilemap->GetHeight();
         float tw = tilemap->GetTileWidth();
         float th = tilemap->GetTileHeight();
         float totalW = w * tw;
         float totalH = h * th;
-        float z = base.z + 0.01f;
-        // Pick thickness ~1px
-        float thickness = 0.005f;
-        if (auto *cam = Core::Camera::GetActive(); cam && window)
-        {
-            float visibleH = 2.0f * cam->GetOrthographicSize() / std::max(cam->GetZoom(), 0.0001f);
-            float perPixel = visibleH / (float)window->GetHeight();
-            thickness = std::max(perPixel, perPixel * 0.5f);
-        }
         glm::vec4 lineColor(1.0f, 1.0f, 1.0f, 0.15f);
+        // Lines are laid out in map space and follow the map's rotation/scale
         // Vertical lines
         for (int x = 0; x <= w; ++x)
         {
-            float lx = base.x + x * tw;
-            renderer->DrawQuad(glm::vec3(lx, base.y + totalH * 0.5f, z), glm::vec2(thickness, totalH), lineColor);
+            float lx = x * tw;
+            DebugDraw::Line(tilemap->LocalToWorld(glm::vec2(lx, 0.0f)), tilemap->LocalToWorld(glm::vec2(lx, totalH)), lineColor);
         }
         // Horizontal lines
         for (int y = 0; y <= h; ++y)
         {
-            float ly = base.y + y * th;
-            renderer->DrawQuad(glm::vec3(base.x + totalW * 0.5f, ly, z), glm::vec2(totalW, thickness), lineColor);
+            float ly = y * th;
+            DebugDraw::Line(tilemap->LocalToWorld(glm::vec2(0.0f, ly)), tilemap->LocalToWorld(glm::vec2(totalW, ly)), lineColor);
         }
     }
 
@@ -1198,7 +1314,7 @@ namespace Kiaak
             if (!camComp)
                 return; // nothing selectable for gizmo
 
-            glm::vec3 pos = transform->GetPosition();
+            glm::vec3 pos = transform->GetWorldPosition();
             float halfH = camComp->GetOrthographicSize() / std::max(camComp->GetZoom(), 0.0001f);
             float aspect = 1.0f;
             if (window)
@@ -1216,12 +1332,7 @@ namespace Kiaak
             maxY = pos.y + halfH;
         }
 
-        const float width = std::max(0.0f, maxX - minX);
-        const float height = std::max(0.0f, maxY - minY);
-        const glm::vec2 ctr = {(minX + maxX) * 0.5f, (minY + maxY) * 0.5f};
-        const float z = transform->GetPosition().z + 0.02f; // nudge above sprite to avoid z-fighting
-
-        // Thickness ~2px in world units
+        // Handle size ~6px in world units
         float thickness = 0.01f;
         if (auto *cam = Core::Camera::GetActive(); cam && window)
         {
@@ -1233,29 +1344,14 @@ namespace Kiaak
         const glm::vec4 gizmoColor(1.0f, 0.6f, 0.05f, 1.0f);
 
         // Draw outline
-        // Top
-        renderer->DrawQuad(glm::vec3(ctr.x, maxY + thickness * 0.5f, z),
-                           glm::vec2(width + thickness * 2.0f, thickness),
-                           gizmoColor);
-        // Bottom
-        renderer->DrawQuad(glm::vec3(ctr.x, minY - thickness * 0.5f, z),
-                           glm::vec2(width + thickness * 2.0f, thickness),
-                           gizmoColor);
-        // Left
-        renderer->DrawQuad(glm::vec3(minX - thickness * 0.5f, ctr.y, z),
-                           glm::vec2(thickness, height),
-                           gizmoColor);
-        // Right
-        renderer->DrawQuad(glm::vec3(maxX + thickness * 0.5f, ctr.y, z),
-                           glm::vec2(thickness, height),
-                           gizmoColor);
+        DebugDraw::Box(glm::vec2(minX, minY), glm::vec2(maxX, maxY), gizmoColor);
 
         // Corner handles
-        const float handle = thickness * 3.0f;
-        renderer->DrawQuad(glm::vec3(minX, minY, z), glm::vec2(handle, handle), gizmoColor);
-        renderer->DrawQuad(glm::vec3(maxX, minY, z), glm::vec2(handle, handle), gizmoColor);
-        renderer->DrawQuad(glm::vec3(maxX, maxY, z), glm::vec2(handle, handle), gizmoColor);
-        renderer->DrawQuad(glm::vec3(minX, maxY, z), glm::vec2(handle, handle), gizmoColor);
+        const glm::vec2 handle(thickness * 3.0f);
+        DebugDraw::FilledRect(glm::vec2(minX, minY), handle, gizmoColor);
+        DebugDraw::FilledRect(glm::vec2(maxX, minY), handle, gizmoColor);
+        DebugDraw::FilledRect(glm::vec2(maxX, maxY), handle, gizmoColor);
+        DebugDraw::FilledRect(glm::vec2(minX, maxY), handle, gizmoColor);
 
         // Drag translate / click outside to deselect
         auto *cam = Core::Camera::GetActive();
@@ -1280,14 +1376,14 @@ namespace Kiaak
         {
             gizmoDragging = true;
             gizmoDragStartWorld = world;
-            gizmoOriginalPos = transform->GetPosition();
+            gizmoOriginalPos = transform->GetWorldPosition();
         }
         if (gizmoDragging)
         {
             if (leftHeld)
             {
                 glm::vec2 delta = world - gizmoDragStartWorld;
-                transform->SetPosition(gizmoOriginalPos + glm::vec3(delta.x, delta.y, 0.0f));
+                transform->SetWorldPosition(gizmoOriginalPos + glm::vec3(delta.x, delta.y, 0.0f));
             }
             if (leftReleased)
             {
@@ -1310,4 +1406,101 @@ namespace Kiaak
         }
     }
 
+    void Engine::DrawProfilerOverlay()
+    {
+        ImGui::SetNextWindowPos(ImVec2(340, 44), ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowSize(ImVec2(360, 0), ImGuiCond_FirstUseEver);
+        bool open = true;
+        if (ImGui::Begin("Profiler (F3)", &open))
+        {
+            const auto &cpu = Profiler::GetCpuFrame();
+            const auto &cpuValues = cpu.Values();
+            char label[64];
+            snprintf(label, sizeof(label), "%.2f ms", cpu.Last());
+            ImGui::Text("CPU frame  p50 %.2f  p95 %.2f  p99 %.2f ms",
+                        cpu.Percentile(0.50f), cpu.Percentile(0.95f), cpu.Percentile(0.99f));
+            ImGui::PlotLines("##cpu", cpuValues.data(), static_cast<int>(cpuValues.size()), 0, label, 0.0f, std::max(33.3f, cpu.Percentile(0.99f)), ImVec2(-1, 60));
+            for (int i = 0; i < static_cast<int>(Profiler::CpuStage::Count); ++i)
+            {
+                auto stage = static_cast<Profiler::CpuStage>(i);
+                const auto &h = Profiler::GetCpu(stage);
+                ImGui::Text("  %-14s %6.2f ms  (avg %.2f)", Profiler::GetName(stage), h.Last(), h.Average());
+            }
+
+            ImGui::Separator();
+            if (Profiler::HasGpuTimings())
+            {
+                const auto &gpu = Profiler::GetGpuFrame();
+                const auto &gpuValues = gpu.Values();
+                snprintf(label, sizeof(label), "%.2f ms", gpu.Last());
+                ImGui::Text("GPU frame  p50 %.2f  p95 %.2f  p99 %.2f ms",
+                            gpu.Percentile(0.50f), gpu.Percentile(0.95f), gpu.Percentile(0.99f));
+                ImGui::PlotLines("##gpu", gpuValues.data(), static_cast<int>(gpuValues.size()), 0, label, 0.0f, std::max(16.6f, gpu.Percentile(0.99f)), ImVec2(-1, 60));
+                for (int i = 0; i < static_cast<int>(Profiler::GpuStage::Count); ++i)
+                {
+                    auto stage = static_cast<Profiler::GpuStage>(i);
+                    const auto &h = Profiler::GetGpu(stage);
+                    ImGui::Text("  %-26s %6.2f ms", Profiler::GetName(stage), h.Last());
+                }
+                ImGui::TextDisabled("GPU timings lag %d frames behind", Profiler::kGpuLatency);
+            }
+            else
+            {
+                ImGui::TextDisabled("Waiting for GPU timer queries...");
+            }
+            ImGui::Separator();
+            ImGui::Text("Textures loading: %zu  (uploaded %.1f KB last frame)", TextureLoader::GetPendingCount(),
+                        static_cast<double>(TextureLoader::GetLastUploadBytes()) / 1024.0);
+            const auto cache = TextureCache::GetStats();
+            ImGui::Text("Texture cache: %zu entries (%zu in use), %.1f MB resident", cache.entries, cache.referenced,
+                        static_cast<double>(cache.residentBytes) / (1024.0 * 1024.0));
+            ImGui::Text("  hits %llu  misses %llu  evicted %llu", static_cast<unsigned long long>(cache.hits),
+                        static_cast<unsigned long long>(cache.misses), static_cast<unsigned long long>(cache.evictions));
+            const double residentMB = static_cast<double>(Texture::GetResidentBytes()) / (1024.0 * 1024.0);
+            if (Texture::GetMemoryBudget() > 0)
+                ImGui::Text("Texture memory: %.1f / %.1f MB  (evictions %llu, reloads %llu)", residentMB,
+                            static_cast<double>(Texture::GetMemoryBudget()) / (1024.0 * 1024.0),
+                            static_cast<unsigned long long>(Texture::GetEvictionCount()),
+                            static_cast<unsigned long long>(Texture::GetReloadCount()));
+            else
+                ImGui::Text("Texture memory: %.1f MB (no budget)", residentMB);
+
+            ImGui::Separator();
+            ImGui::Text("Component pools (live / capacity)");
+            for (const auto &pool : Core::ComponentPoolBase::GetAllStats())
+                ImGui::Text("  %-18s %6zu / %-6zu %4zu B", pool.typeName.c_str(), pool.live, pool.capacity, pool.blockSize);
+        }
+        ImGui::End();
+        if (!open)
+            Profiler::SetOverlayVisible(false);
+    }
+
+    void Engine::PrintProfilerSummary() const
+    {
+        const auto &cpu = Profiler::GetCpuFrame();
+        if (cpu.Count() == 0)
+            return;
+        std::cout << "Frame times over the last " << cpu.Count() << " frames (ms)" << std::endl;
+        std::cout << "  CPU p50 " << cpu.Percentile(0.50f) << "  p95 " << cpu.Percentile(0.95f) << "  p99 " << cpu.Percentile(0.99f) << std::endl;
+        for (int i = 0; i < static_cast<int>(Profiler::CpuStage::Count); ++i)
+        {
+            auto stage = static_cast<Profiler::CpuStage>(i);
+            std::cout << "    " << Profiler::GetName(stage) << ": avg " << Profiler::GetCpu(stage).Average() << std::endl;
+        }
+        if (Profiler::HasGpuTimings())
+        {
+            const auto &gpu = Profiler::GetGpuFrame();
+            std::cout << "  GPU p50 " << gpu.Percentile(0.50f) << "  p95 " << gpu.Percentile(0.95f) << "  p99 " << gpu.Percentile(0.99f) << std::endl;
+            for (int i = 0; i < static_cast<int>(Profiler::GpuStage::Count); ++i)
+            {
+                auto stage = static_cast<Profiler::GpuStage>(i);
+                std::cout << "    " << Profiler::GetName(stage) << ": avg " << Profiler::GetGpu(stage).Average() << std::endl;
+            }
+        }
+        // Peak-sized pools tell a project what to Reserve() up front
+        std::cout << "Component pools (live / capacity):" << std::endl;
+        for (const auto &pool : Core::ComponentPoolBase::GetAllStats())
+            std::cout << "  " << pool.typeName << ": " << pool.live << " / " << pool.capacity << " (" << pool.blockSize << " B each)" << std::endl;
+    }
+
 } // namespace Kiaak
@@ -0,0 +1,188 @@
+#include "Graphics/DebugDraw.hpp"
+#include "Graphics/Renderer.hpp"
+#include "Graphics/RenderState.hpp"
+#include "Graphics/Shader.hpp"
+#include "Graphics/VertexArray.hpp"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+namespace Kiaak
+{
+
+    std::vector<DebugDraw::Vertex> DebugDraw::s_lines;
+    std::vector<DebugDraw::Vertex> DebugDraw::s_triangles;
+    std::vector<DebugDraw::TextMarker> DebugDraw::s_text;
+    std::unique_ptr<Shader> DebugDraw::s_shader = nullptr;
+    std::unique_ptr<VertexArray> DebugDraw::s_vao = nullptr;
+    unsigned int DebugDraw::s_vaoBuffer = 0;
+    uint32_t DebugDraw::s_lastVertexCount = 0;
+
+    uint32_t DebugDraw::Pack(const glm::vec4 &color)
+    {
+        auto ch = [](float v)
+        { return (uint32_t)(std::min(std::max(v, 0.0f), 1.0f) * 255.0f + 0.5f); };
+        // Byte order r,g,b,a in memory (little endian)
+        return ch(color.x) | (ch(color.y) << 8) | (ch(color.z) << 16) | (ch(color.w) << 24);
+    }
+
+    void DebugDraw::Line(const glm::vec2 &a, const glm::vec2 &b, const glm::vec4 &color)
+    {
+        const uint32_t c = Pack(color);
+        s_lines.push_back({a.x, a.y, c});
+        s_lines.push_back({b.x, b.y, c});
+    }
+
+    void DebugDraw::Box(const glm::vec2 &min, const glm::vec2 &max, const glm::vec4 &color)
+    {
+        const uint32_t c = Pack(color);
+        const Vertex v[8] = {{min.x, min.y, c}, {max.x, min.y, c}, {max.x, min.y, c}, {max.x, max.y, c},
+                             {max.x, max.y, c}, {min.x, max.y, c}, {min.x, max.y, c}, {min.x, min.y, c}};
+        s_lines.insert(s_lines.end(), v, v + 8);
+    }
+
+    void DebugDraw::FilledRect(const glm::vec2 &center, const glm::vec2 &size, const glm::vec4 &color)
+    {
+        const uint32_t c = Pack(color);
+        const glm::vec2 mn = center - size * 0.5f;
+        const glm::vec2 mx = center + size * 0.5f;
+        const Vertex v[6] = {{mn.x, mn.y, c}, {mx.x, mn.y, c}, {mx.x, mx.y, c},
+                             {mn.x, mn.y, c}, {mx.x, mx.y, c}, {mn.x, mx.y, c}};
+        s_triangles.insert(s_triangles.end(), v, v + 6);
+    }
+
+    void DebugDraw::Circle(const glm::vec2 &center, float radius, const glm::vec4 &color, int segments)
+    {
+        if (segments < 3)
+            segments = 3;
+        const uint32_t c = Pack(color);
+        const float step = 6.28318530718f / (float)segments;
+        glm::vec2 prev = center + glm::vec2(radius, 0.0f);
+        for (int i = 1; i <= segments; ++i)
+        {
+            const float a = step * (float)i;
+            const glm::vec2 p = center + radius * glm::vec2(std::cos(a), std::sin(a));
+            s_lines.push_back({prev.x, prev.y, c});
+            s_lines.push_back({p.x, p.y, c});
+            prev = p;
+        }
+    }
+
+    void DebugDraw::Text(const glm::vec2 &position, const std::string &text, const glm::vec4 &color)
+    {
+        s_text.push_back({position, color, text});
+    }
+
+    bool DebugDraw::EnsureResources()
+    {
+        StreamBuffer *stream = Renderer::GetVertexStream();
+        if (!stream)
+            return false;
+
+        if (!s_shader)
+        {
+            const char *vs = R"(#version 330 core
+layout(location=0) in vec2 aPos;
+layout(location=1) in vec4 aColor;
+layout(std140) uniform Camera { mat4 uView; mat4 uProjection; mat4 uViewProjection; vec4 uViewportTime; };
+out vec4 vColor;
+void main(){ gl_Position = uViewProjection * vec4(aPos,0.0,1.0); vColor = aColor; })";
+            const char *fs = R"(#version 330 core
+in vec4 vColor; out vec4 FragColor; void main(){ FragColor = vColor; })";
+            s_shader = std::make_unique<Shader>();
+            if (!s_shader->LoadFromString(vs, fs))
+            {
+                std::cerr << "Failed to create debug draw shader" << std::endl;
+                s_shader.reset();
+                return false;
+            }
+        }
+
+        if (!s_vao || s_vaoBuffer != stream->GetID())
+        {
+            s_vao = std::make_unique<VertexArray>();
+            s_vao->Bind();
+            RenderState::BindBuffer(GL_ARRAY_BUFFER, stream->GetID());
+            glEnableVertexAttribArray(0);
+            glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)0);
+            glEnableVertexAttribArray(1);
+            glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void *)(2 * sizeof(float)));
+            s_vaoBuffer = stream->GetID();
+        }
+        return true;
+    }
+
+    void DebugDraw::Submit(std::vector<Vertex> &verts, unsigned int mode)
+    {
+        StreamBuffer *stream = Renderer::GetVertexStream();
+        const unsigned int perPrimitive = (mode == GL_LINES) ? 2u : 3u;
+        size_t first = 0;
+        // One allocation normally; split only if the stream region can't take it all
+        while (first < verts.size())
+        {
+            size_t count = verts.size() - first;
+            unsigned int offset = 0;
+            void *dst = nullptr;
+            while (count >= perPrimitive)
+            {
+                dst = stream->Allocate((unsigned int)(count * sizeof(Vertex)), sizeof(Vertex), offset);
+                if (dst)
+                    break;
+                count = (count / 2) / perPrimitive * perPrimitive;
+            }
+            if (!dst)
+            {
+                std::cerr << "DebugDraw: vertex stream full, dropped " << (verts.size() - first) << " vertices" << std::endl;
+                break;
+            }
+            std::memcpy(dst, verts.data() + first, count * sizeof(Vertex));
+            stream->Commit();
+            glDrawArrays(mode, (GLint)(offset / sizeof(Vertex)), (GLsizei)count);
+            s_lastVertexCount += (uint32_t)count;
+            first += count;
+        }
+        verts.clear();
+    }
+
+    void DebugDraw::Flush()
+    {
+        s_lastVertexCount = 0;
+        if (s_lines.empty() && s_triangles.empty())
+            return;
+        if (!EnsureResources())
+        {
+            s_lines.clear();
+            s_triangles.clear();
+            return;
+        }
+
+        // Overlay: ignore and keep the scene's depth
+        const bool depthEnabled = RenderState::IsDepthTestEnabled();
+        const bool depthMask = RenderState::IsDepthMaskEnabled();
+        RenderState::SetDepthTest(false);
+        RenderState::SetDepthMask(false);
+
+        s_shader->Use();
+        s_vao->Bind();
+        if (!s_triangles.empty())
+            Submit(s_triangles, GL_TRIANGLES);
+        if (!s_lines.empty())
+            Submit(s_lines, GL_LINES);
+
+        RenderState::SetDepthMask(depthMask);
+        RenderState::SetDepthTest(depthEnabled);
+    }
+
+    void DebugDraw::Shutdown()
+    {
+        s_lines.clear();
+        s_triangles.clear();
+        s_text.clear();
+        s_vao.reset();
+        s_vaoBuffer = 0;
+        s_shader.reset();
+    }
+
+} // namespace Kiaak
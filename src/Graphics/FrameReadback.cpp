@@ -0,0 +1,134 @@
+#include "Graphics/FrameReadback.hpp"
+#include "Graphics/RenderState.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace Kiaak
+{
+
+    FrameReadback::FrameReadback(unsigned int slots)
+    {
+        m_slots.resize(slots ? slots : 1);
+        for (auto &slot : m_slots)
+            glGenBuffers(1, &slot.pbo);
+    }
+
+    FrameReadback::~FrameReadback()
+    {
+        for (auto &slot : m_slots)
+        {
+            if (slot.fence)
+                glDeleteSync(slot.fence);
+            RenderState::OnDeleteBuffer(slot.pbo);
+            glDeleteBuffers(1, &slot.pbo);
+        }
+    }
+
+    void FrameReadback::Request(int width, int height)
+    {
+        if (width <= 0 || height <= 0)
+            return;
+        if (m_pending == m_slots.size())
+        {
+            // Ring full: the oldest copy was never fetched, reuse it
+            m_pending--;
+        }
+
+        Slot &slot = m_slots[m_head];
+        if (slot.fence)
+        {
+            glDeleteSync(slot.fence);
+            slot.fence = nullptr;
+        }
+        const size_t bytes = (size_t)width * (size_t)height * 4;
+        RenderState::BindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+        if (bytes > slot.capacity)
+        {
+            glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+            slot.capacity = bytes;
+        }
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        // With a pack buffer bound this returns immediately; the copy happens on the GPU
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        RenderState::BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.width = width;
+        slot.height = height;
+
+        m_head = (m_head + 1) % (unsigned int)m_slots.size();
+        m_pending++;
+    }
+
+    bool FrameReadback::Fetch(std::vector<uint8_t> &outRGBA, int &outWidth, int &outHeight, bool wait)
+    {
+        if (m_pending == 0)
+            return false;
+        const unsigned int count = (unsigned int)m_slots.size();
+        Slot &slot = m_slots[(m_head + count - m_pending) % count];
+
+        if (slot.fence)
+        {
+            GLbitfield flags = wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0;
+            GLuint64 timeout = wait ? 1000000000ull : 0; // 1 s per attempt
+            GLenum result;
+            do
+            {
+                result = glClientWaitSync(slot.fence, flags, timeout);
+            } while (wait && result == GL_TIMEOUT_EXPIRED);
+            if (result == GL_TIMEOUT_EXPIRED)
+                return false; // not ready yet
+            glDeleteSync(slot.fence);
+            slot.fence = nullptr;
+        }
+
+        const size_t bytes = (size_t)slot.width * (size_t)slot.height * 4;
+        RenderState::BindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+        const void *src = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, GL_MAP_READ_BIT);
+        bool ok = src != nullptr;
+        if (ok)
+        {
+            outRGBA.resize(bytes);
+            std::memcpy(outRGBA.data(), src, bytes);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            outWidth = slot.width;
+            outHeight = slot.height;
+        }
+        else
+        {
+            std::cerr << "FrameReadback: failed to map pixel buffer" << std::endl;
+        }
+        RenderState::BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        m_pending--;
+        return ok;
+    }
+
+    bool FrameReadback::WritePPM(const std::string &path, const std::vector<uint8_t> &rgba, int width, int height)
+    {
+        if (width <= 0 || height <= 0 || rgba.size() < (size_t)width * (size_t)height * 4)
+            return false;
+        std::ofstream out(path, std::ios::binary);
+        if (!out.is_open())
+        {
+            std::cerr << "Failed to open " << path << " for writing" << std::endl;
+            return false;
+        }
+        out << "P6\n"
+            << width << " " << height << "\n255\n";
+        std::vector<char> row((size_t)width * 3);
+        // GL rows are bottom-up; PPM is top-down
+        for (int y = height - 1; y >= 0; --y)
+        {
+            const uint8_t *src = rgba.data() + (size_t)y * width * 4;
+            for (int x = 0; x < width; ++x)
+            {
+                row[x * 3 + 0] = (char)src[x * 4 + 0];
+                row[x * 3 + 1] = (char)src[x * 4 + 1];
+                row[x * 3 + 2] = (char)src[x * 4 + 2];
+            }
+            out.write(row.data(), (std::streamsize)row.size());
+        }
+        return out.good();
+    }
+
+} // namespace Kiaak
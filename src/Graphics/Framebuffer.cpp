@@ -0,0 +1,96 @@
+#include "Graphics/Framebuffer.hpp"
+#include "Graphics/RenderState.hpp"
+#include <iostream>
+
+namespace Kiaak
+{
+
+    Framebuffer::Framebuffer(int width, int height)
+        : m_width(width > 0 ? width : 1), m_height(height > 0 ? height : 1)
+    {
+        Create();
+    }
+
+    Framebuffer::~Framebuffer()
+    {
+        Destroy();
+    }
+
+    bool Framebuffer::Resize(int width, int height)
+    {
+        if (width <= 0)
+            width = 1;
+        if (height <= 0)
+            height = 1;
+        if (width == m_width && height == m_height)
+            return m_complete;
+        Destroy();
+        m_width = width;
+        m_height = height;
+        Create();
+        return m_complete;
+    }
+
+    void Framebuffer::Bind() const
+    {
+        RenderState::BindFramebuffer(m_framebufferID);
+    }
+
+    void Framebuffer::BindDefault()
+    {
+        RenderState::BindFramebuffer(0);
+    }
+
+    void Framebuffer::Create()
+    {
+        glGenFramebuffers(1, &m_framebufferID);
+        RenderState::BindFramebuffer(m_framebufferID);
+
+        glGenTextures(1, &m_colorTexture);
+        RenderState::BindTexture(m_colorTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_width, m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        RenderState::BindTexture(0u);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_colorTexture, 0);
+
+        glGenRenderbuffers(1, &m_depthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_depthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, m_width, m_height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_depthBuffer);
+
+        m_complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        if (!m_complete)
+            std::cerr << "Framebuffer " << m_framebufferID << " is incomplete (" << m_width << "x" << m_height << ")" << std::endl;
+        else
+            std::cout << "Created Framebuffer with ID: " << m_framebufferID << " (" << m_width << "x" << m_height << ")" << std::endl;
+
+        RenderState::BindFramebuffer(0);
+    }
+
+    void Framebuffer::Destroy()
+    {
+        if (m_framebufferID)
+        {
+            RenderState::OnDeleteFramebuffer(m_framebufferID);
+            glDeleteFramebuffers(1, &m_framebufferID);
+            m_framebufferID = 0;
+        }
+        if (m_colorTexture)
+        {
+            RenderState::OnDeleteTexture(m_colorTexture);
+            glDeleteTextures(1, &m_colorTexture);
+            m_colorTexture = 0;
+        }
+        if (m_depthBuffer)
+        {
+            glDeleteRenderbuffers(1, &m_depthBuffer);
+            m_depthBuffer = 0;
+        }
+        m_complete = false;
+    }
+
+} // namespace Kiaak
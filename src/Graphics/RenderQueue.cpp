@@ -0,0 +1,65 @@
+#include "Graphics/RenderQueue.hpp"
+#include <cstring>
+#include <utility>
+
+namespace Kiaak
+{
+    namespace Graphics
+    {
+
+        uint64_t RenderQueue::MakeKey(uint32_t layer, float z, uint32_t shaderID, uint32_t textureID)
+        {
+            // Flip float bits so unsigned comparison matches numeric order (-0 sorts as 0)
+            if (z == 0.0f)
+                z = 0.0f;
+            uint32_t zBits;
+            std::memcpy(&zBits, &z, sizeof(zBits));
+            zBits = (zBits & 0x80000000u) ? ~zBits : (zBits | 0x80000000u);
+
+            return ((uint64_t)(layer & 0xFu) << 60) |
+                   ((uint64_t)zBits << 28) |
+                   ((uint64_t)(shaderID & 0xFFu) << 20) |
+                   (uint64_t)(textureID & 0xFFFFFu);
+        }
+
+        void RenderQueue::Push(Kind kind, void *renderable, uint32_t layer, float z,
+                               uint32_t shaderID, uint32_t textureID, uint8_t flags)
+        {
+            m_items.push_back({MakeKey(layer, z, shaderID, textureID), renderable, kind, flags});
+        }
+
+        void RenderQueue::Sort()
+        {
+            const size_t n = m_items.size();
+            if (n < 2)
+                return;
+            m_scratch.resize(n);
+
+            Item *src = m_items.data();
+            Item *dst = m_scratch.data();
+            for (int shift = 0; shift < 64; shift += 8)
+            {
+                size_t counts[256] = {};
+                for (size_t i = 0; i < n; ++i)
+                    counts[(src[i].key >> shift) & 0xFF]++;
+                // Every key shares this digit: the pass would be a no-op
+                if (counts[(src[0].key >> shift) & 0xFF] == n)
+                    continue;
+
+                size_t offset = 0;
+                for (size_t &c : counts)
+                {
+                    size_t tmp = c;
+                    c = offset;
+                    offset += tmp;
+                }
+                for (size_t i = 0; i < n; ++i)
+                    dst[counts[(src[i].key >> shift) & 0xFF]++] = src[i];
+                std::swap(src, dst);
+            }
+            if (src != m_items.data())
+                std::memcpy(m_items.data(), src, n * sizeof(Item));
+        }
+
+    } // namespace Graphics
+} // namespace Kiaak
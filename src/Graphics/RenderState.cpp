@@ -0,0 +1,364 @@
+#include "Graphics/RenderState.hpp"
+
+namespace Kiaak
+{
+
+    GLuint RenderState::s_program = RenderState::kUnknown;
+    unsigned int RenderState::s_activeUnit = RenderState::kUnknown;
+    GLuint RenderState::s_textures[RenderState::kMaxTextureUnits];
+    GLuint RenderState::s_vao = RenderState::kUnknown;
+    GLuint RenderState::s_framebuffer = RenderState::kUnknown;
+    GLuint RenderState::s_buffers[RenderState::BufferSlotCount];
+    int8_t RenderState::s_blend = -1;
+    int8_t RenderState::s_depthTest = -1;
+    int8_t RenderState::s_depthMask = -1;
+    GLenum RenderState::s_blendSrc = 0;
+    GLenum RenderState::s_blendDst = 0;
+    GLenum RenderState::s_blendSrcAlpha = 0;
+    GLenum RenderState::s_blendDstAlpha = 0;
+    int RenderState::s_viewport[4] = {0, 0, 0, 0};
+    bool RenderState::s_viewportKnown = false;
+    RenderState::Stats RenderState::s_frame;
+    RenderState::Stats RenderState::s_lastFrame;
+    RenderState::Stats RenderState::s_total;
+
+    namespace
+    {
+        // Arrays above start zeroed; mark everything unknown before first use
+        struct RenderStateInit
+        {
+            RenderStateInit() { RenderState::Invalidate(); }
+        } s_renderStateInit;
+    }
+
+    void RenderState::Invalidate()
+    {
+        s_program = kUnknown;
+        s_activeUnit = kUnknown;
+        for (auto &t : s_textures)
+            t = kUnknown;
+        s_vao = kUnknown;
+        s_framebuffer = kUnknown;
+        for (auto &b : s_buffers)
+            b = kUnknown;
+        s_blend = s_depthTest = s_depthMask = -1;
+        s_blendSrc = s_blendDst = s_blendSrcAlpha = s_blendDstAlpha = 0;
+        s_viewportKnown = false;
+    }
+
+    void RenderState::BeginFrame()
+    {
+        s_lastFrame = s_frame;
+        s_frame = Stats{};
+    }
+
+    void RenderState::UseProgram(GLuint program)
+    {
+        if (s_program == program)
+        {
+            Skipped();
+            return;
+        }
+        glUseProgram(program);
+        s_program = program;
+        Issued();
+    }
+
+    void RenderState::ActiveTexture(unsigned int unit)
+    {
+        if (s_activeUnit == unit)
+        {
+            Skipped();
+            return;
+        }
+        glActiveTexture(GL_TEXTURE0 + unit);
+        s_activeUnit = unit;
+        Issued();
+    }
+
+    void RenderState::BindTexture(unsigned int unit, GLuint texture)
+    {
+        if (unit < kMaxTextureUnits && s_textures[unit] == texture)
+        {
+            Skipped();
+            return;
+        }
+        ActiveTexture(unit);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        if (unit < kMaxTextureUnits)
+            s_textures[unit] = texture;
+        Issued();
+    }
+
+    void RenderState::BindTexture(GLuint texture)
+    {
+        if (s_activeUnit == kUnknown)
+            ActiveTexture(0);
+        BindTexture(s_activeUnit, texture);
+    }
+
+    void RenderState::BindVertexArray(GLuint vao)
+    {
+        if (s_vao == vao)
+        {
+            Skipped();
+            return;
+        }
+        glBindVertexArray(vao);
+        s_vao = vao;
+        // The element buffer binding is part of the VAO
+        s_buffers[ElementBuffer] = kUnknown;
+        Issued();
+    }
+
+    int RenderState::BufferSlotFor(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_ARRAY_BUFFER:
+            return ArrayBuffer;
+        case GL_ELEMENT_ARRAY_BUFFER:
+            return ElementBuffer;
+        case GL_UNIFORM_BUFFER:
+            return UniformBuffer;
+        case GL_PIXEL_PACK_BUFFER:
+            return PixelPackBuffer;
+        case GL_PIXEL_UNPACK_BUFFER:
+            return PixelUnpackBuffer;
+        case GL_COPY_READ_BUFFER:
+            return CopyReadBuffer;
+        case GL_COPY_WRITE_BUFFER:
+            return CopyWriteBuffer;
+        default:
+            return -1;
+        }
+    }
+
+    void RenderState::BindBuffer(GLenum target, GLuint buffer)
+    {
+        int slot = BufferSlotFor(target);
+        if (slot >= 0 && s_buffers[slot] == buffer)
+        {
+            Skipped();
+            return;
+        }
+        glBindBuffer(target, buffer);
+        if (slot >= 0)
+            s_buffers[slot] = buffer;
+        Issued();
+    }
+
+    void RenderState::BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        glBindBufferBase(target, index, buffer);
+        int slot = BufferSlotFor(target);
+        if (slot >= 0)
+            s_buffers[slot] = buffer;
+        Issued();
+    }
+
+    void RenderState::BindFramebuffer(GLuint framebuffer)
+    {
+        if (s_framebuffer == framebuffer)
+        {
+            Skipped();
+            return;
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        s_framebuffer = framebuffer;
+        Issued();
+    }
+
+    void RenderState::SetBlend(bool enabled)
+    {
+        if (s_blend == (int8_t)enabled)
+        {
+            Skipped();
+            return;
+        }
+        if (enabled)
+            glEnable(GL_BLEND);
+        else
+            glDisable(GL_BLEND);
+        s_blend = (int8_t)enabled;
+        Issued();
+    }
+
+    void RenderState::SetBlendFunc(GLenum src, GLenum dst)
+    {
+        SetBlendFuncSeparate(src, dst, src, dst);
+    }
+
+    void RenderState::SetBlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+    {
+        if (s_blendSrc == srcRGB && s_blendDst == dstRGB && s_blendSrcAlpha == srcAlpha && s_blendDstAlpha == dstAlpha)
+        {
+            Skipped();
+            return;
+        }
+        glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+        s_blendSrc = srcRGB;
+        s_blendDst = dstRGB;
+        s_blendSrcAlpha = srcAlpha;
+        s_blendDstAlpha = dstAlpha;
+        Issued();
+    }
+
+    void RenderState::GetBlendFunc(GLenum out[4])
+    {
+        out[0] = s_blendSrc;
+        out[1] = s_blendDst;
+        out[2] = s_blendSrcAlpha;
+        out[3] = s_blendDstAlpha;
+    }
+
+    void RenderState::SetDepthTest(bool enabled)
+    {
+        if (s_depthTest == (int8_t)enabled)
+        {
+            Skipped();
+            return;
+        }
+        if (enabled)
+            glEnable(GL_DEPTH_TEST);
+        else
+            glDisable(GL_DEPTH_TEST);
+        s_depthTest = (int8_t)enabled;
+        Issued();
+    }
+
+    void RenderState::SetDepthMask(bool enabled)
+    {
+        if (s_depthMask == (int8_t)enabled)
+        {
+            Skipped();
+            return;
+        }
+        glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+        s_depthMask = (int8_t)enabled;
+        Issued();
+    }
+
+    void RenderState::SetViewport(int x, int y, int width, int height)
+    {
+        if (s_viewportKnown && s_viewport[0] == x && s_viewport[1] == y && s_viewport[2] == width && s_viewport[3] == height)
+        {
+            Skipped();
+            return;
+        }
+        glViewport(x, y, width, height);
+        s_viewport[0] = x;
+        s_viewport[1] = y;
+        s_viewport[2] = width;
+        s_viewport[3] = height;
+        s_viewportKnown = true;
+        Issued();
+    }
+
+    // Queries only reach the driver when the shadow value is unknown (after Invalidate)
+    bool RenderState::IsBlendEnabled()
+    {
+        if (s_blend < 0)
+        {
+            s_blend = glIsEnabled(GL_BLEND) ? 1 : 0;
+            Issued();
+        }
+        else
+            Skipped();
+        return s_blend == 1;
+    }
+
+    bool RenderState::IsDepthTestEnabled()
+    {
+        if (s_depthTest < 0)
+        {
+            s_depthTest = glIsEnabled(GL_DEPTH_TEST) ? 1 : 0;
+            Issued();
+        }
+        else
+            Skipped();
+        return s_depthTest == 1;
+    }
+
+    bool RenderState::IsDepthMaskEnabled()
+    {
+        if (s_depthMask < 0)
+        {
+            GLboolean mask = GL_TRUE;
+            glGetBooleanv(GL_DEPTH_WRITEMASK, &mask);
+            s_depthMask = mask ? 1 : 0;
+            Issued();
+        }
+        else
+            Skipped();
+        return s_depthMask == 1;
+    }
+
+    void RenderState::GetViewport(int out[4])
+    {
+        if (!s_viewportKnown)
+        {
+            GLint vp[4] = {0, 0, 0, 0};
+            glGetIntegerv(GL_VIEWPORT, vp);
+            for (int i = 0; i < 4; ++i)
+                s_viewport[i] = vp[i];
+            s_viewportKnown = true;
+            Issued();
+        }
+        else
+            Skipped();
+        for (int i = 0; i < 4; ++i)
+            out[i] = s_viewport[i];
+    }
+
+    int RenderState::GetViewportWidth()
+    {
+        int vp[4];
+        GetViewport(vp);
+        return vp[2];
+    }
+
+    int RenderState::GetViewportHeight()
+    {
+        int vp[4];
+        GetViewport(vp);
+        return vp[3];
+    }
+
+    void RenderState::OnDeleteProgram(GLuint program)
+    {
+        // A deleted program stays current until replaced; force the next Use to issue
+        if (s_program == program)
+            s_program = kUnknown;
+    }
+
+    void RenderState::OnDeleteTexture(GLuint texture)
+    {
+        for (auto &t : s_textures)
+            if (t == texture)
+                t = 0;
+    }
+
+    void RenderState::OnDeleteVertexArray(GLuint vao)
+    {
+        if (s_vao == vao)
+        {
+            s_vao = 0;
+            s_buffers[ElementBuffer] = kUnknown;
+        }
+    }
+
+    void RenderState::OnDeleteFramebuffer(GLuint framebuffer)
+    {
+        if (s_framebuffer == framebuffer)
+            s_framebuffer = 0;
+    }
+
+    void RenderState::OnDeleteBuffer(GLuint buffer)
+    {
+        for (auto &b : s_buffers)
+            if (b == buffer)
+                b = 0;
+    }
+
+} // namespace Kiaak
@@ -3,7 +3,13 @@
 #include "Graphics/Texture.hpp"
 #include "Graphics/VertexArray.hpp"
 #include "Graphics/VertexBuffer.hpp"
+#include "Graphics/RenderState.hpp"
+#include "Graphics/DebugDraw.hpp"
+#include "Graphics/StaticLayer.hpp"
+#include "Graphics/TextureCache.hpp"
+#include "Graphics/TextureLoader.hpp"
 #include "Core/Camera.hpp"
+#include "Core/Profiler.hpp"
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <glm/gtc/matrix_transform.hpp>
@@ -12,6 +18,10 @@
 namespace Kiaak
 {
 
+    StreamBuffer *Renderer::s_vertexStream = nullptr;
+    UniformBuffer *Renderer::s_cameraBuffer = nullptr;
+    const Renderer::CameraUniforms *Renderer::s_frameCamera = nullptr;
+
     Renderer::Renderer() : targetWindow(nullptr), isInitialized(false) {}
 
     Renderer::~Renderer()
@@ -32,6 +42,9 @@ namespace Kiaak
         }
         std::cout << "GLAD initialized successfully!" << std::endl;
 
+        // Start from a clean shadow copy; anything cached before now is unreliable
+        RenderState::Invalidate();
+
         // Print OpenGL information
         std::cout << "OpenGL Version: " << glGetString(GL_VERSION) << std::endl;
         std::cout << "OpenGL Renderer: " << glGetString(GL_RENDERER) << std::endl;
@@ -42,15 +55,35 @@ namespace Kiaak
             return false;
         }
 
+        if (window.IsHeadless())
+        {
+            m_offscreen = std::make_unique<Framebuffer>(window.GetFramebufferWidth(), window.GetFramebufferHeight());
+            if (!m_offscreen->IsComplete())
+            {
+                std::cerr << "Failed to create offscreen framebuffer" << std::endl;
+                return false;
+            }
+            m_readback = std::make_unique<FrameReadback>(2);
+        }
+
+        m_cameraUBO = std::make_unique<UniformBuffer>(static_cast<unsigned int>(sizeof(CameraUniforms)), kCameraBlockBinding);
+        s_cameraBuffer = m_cameraUBO.get();
+        s_frameCamera = &m_cameraData;
+
+        // 4 MB of dynamic vertices per frame (sprites, debug lines), three frames in flight
+        m_vertexStream = std::make_unique<StreamBuffer>(GL_ARRAY_BUFFER, 4 * 1024 * 1024, 3);
+        s_vertexStream = m_vertexStream.get();
+
         // Initialize quad renderer
         InitializeQuadRenderer();
 
         // Enable depth testing
-        glEnable(GL_DEPTH_TEST);
+        RenderState::SetDepthTest(true);
+        RenderState::SetDepthMask(true);
 
         // Enable alpha blending
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        RenderState::SetBlend(true);
+        RenderState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
         isInitialized = true;
         return true;
@@ -66,7 +99,7 @@ namespace Kiaak
 
         int fbw = targetWindow->GetFramebufferWidth();
         int fbh = targetWindow->GetFramebufferHeight();
-        glViewport(0, 0, fbw, fbh);
+        RenderState::SetViewport(0, 0, fbw, fbh);
 
         return true;
     }
@@ -84,11 +117,25 @@ namespace Kiaak
                 fbw = 1;
             if (fbh <= 0)
                 fbh = 1;
-            glViewport(0, 0, fbw, fbh);
+            if (m_offscreen)
+            {
+                m_offscreen->Resize(fbw, fbh);
+                m_offscreen->Bind();
+            }
+            RenderState::SetViewport(0, 0, fbw, fbh);
         }
 
+        RenderState::BeginFrame();
+        UpdateCameraUniforms();
+        // Evict over the memory budget before new uploads land
+        Texture::BeginFrame();
+        // Textures decoded since last frame, within the per-frame upload budget
+        TextureLoader::Update();
+
+        Profiler::BeginGpu(Profiler::GpuStage::Clear);
         glClearColor(r, g, b, a);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        Profiler::EndGpu(Profiler::GpuStage::Clear);
     }
 
     void Renderer::EndFrame()
@@ -96,6 +143,18 @@ namespace Kiaak
         if (!isInitialized)
             return;
 
+        // Fence this frame's streamed geometry before presenting
+        if (m_vertexStream)
+            m_vertexStream->EndFrame();
+
+        if (m_offscreen)
+        {
+            // Nothing to present; queue the readback instead of swapping
+            if (m_readbackEveryFrame && m_readback)
+                m_readback->Request(m_offscreen->GetWidth(), m_offscreen->GetHeight());
+            return;
+        }
+
         // Present the rendered frame
         if (targetWindow)
         {
@@ -103,6 +162,44 @@ namespace Kiaak
         }
     }
 
+    void Renderer::SetFrameReadback(bool enabled)
+    {
+        m_readbackEveryFrame = enabled && m_readback;
+    }
+
+    bool Renderer::FetchFrame(std::vector<uint8_t> &outRGBA, int &outWidth, int &outHeight, bool wait)
+    {
+        if (!m_readback)
+            return false;
+        return m_readback->Fetch(outRGBA, outWidth, outHeight, wait);
+    }
+
+    bool Renderer::CaptureFrame(const std::string &path)
+    {
+        if (!m_offscreen || !m_readback)
+        {
+            std::cerr << "CaptureFrame requires a headless renderer" << std::endl;
+            return false;
+        }
+        if (!m_readbackEveryFrame)
+        {
+            m_offscreen->Bind();
+            m_readback->Request(m_offscreen->GetWidth(), m_offscreen->GetHeight());
+        }
+        // Drain the ring; the last copy is the newest frame
+        std::vector<uint8_t> pixels;
+        int w = 0, h = 0;
+        bool any = false;
+        while (m_readback->HasPending())
+            any = m_readback->Fetch(pixels, w, h, true) || any;
+        if (!any)
+            return false;
+        if (!FrameReadback::WritePPM(path, pixels, w, h))
+            return false;
+        std::cout << "Captured " << w << "x" << h << " frame to " << path << std::endl;
+        return true;
+    }
+
     void Renderer::Clear(float r, float g, float b, float a)
     {
         if (!isInitialized)
@@ -115,11 +212,67 @@ namespace Kiaak
     {
         if (isInitialized)
         {
+            // Workers must be stopped before the cache they fill is cleared
+            TextureLoader::Shutdown();
+            TextureCache::Clear();
+            Graphics::StaticLayer::Shutdown();
+            DebugDraw::Shutdown();
+            Profiler::Shutdown();
+            m_readback.reset();
+            m_offscreen.reset();
+            s_vertexStream = nullptr;
+            m_vertexStream.reset();
+            s_cameraBuffer = nullptr;
+            s_frameCamera = nullptr;
+            m_cameraUBO.reset();
             CleanupQuadRenderer();
             isInitialized = false;
         }
     }
 
+    void Renderer::UpdateCameraUniforms()
+    {
+        if (!m_cameraUBO)
+            return;
+
+        const float w = static_cast<float>(RenderState::GetViewportWidth());
+        const float h = static_cast<float>(RenderState::GetViewportHeight());
+        if (auto *cam = Core::Camera::GetActive())
+        {
+            m_cameraData.view = cam->GetView();
+            m_cameraData.projection = cam->GetProjection();
+            m_cameraData.viewProjection = cam->GetViewProjection();
+        }
+        else
+        {
+            // Fallback to screen-space ortho
+            m_cameraData.view = glm::mat4(1.0f);
+            m_cameraData.projection = glm::ortho(-w * 0.5f, w * 0.5f, -h * 0.5f, h * 0.5f, -1.0f, 1.0f);
+            m_cameraData.viewProjection = m_cameraData.projection;
+        }
+        m_cameraData.viewportTime = glm::vec4(w, h, static_cast<float>(glfwGetTime()), 0.0f);
+        m_cameraUBO->SetData(&m_cameraData, sizeof(CameraUniforms));
+    }
+
+    void Renderer::OverrideCameraUniforms(const glm::mat4 &view, const glm::mat4 &projection, int viewportWidth, int viewportHeight)
+    {
+        if (!s_cameraBuffer || !s_frameCamera)
+            return;
+        CameraUniforms data = *s_frameCamera;
+        data.view = view;
+        data.projection = projection;
+        data.viewProjection = projection * view;
+        data.viewportTime.x = static_cast<float>(viewportWidth);
+        data.viewportTime.y = static_cast<float>(viewportHeight);
+        s_cameraBuffer->SetData(&data, sizeof(CameraUniforms));
+    }
+
+    void Renderer::RestoreCameraUniforms()
+    {
+        if (s_cameraBuffer && s_frameCamera)
+            s_cameraBuffer->SetData(s_frameCamera, sizeof(CameraUniforms));
+    }
+
     void Renderer::DrawQuad(const glm::vec3 &position, const glm::vec2 &size, const glm::vec4 &color)
     {
         if (!isInitialized || !m_quadShader || !m_whiteTexture || !m_quadVAO)
@@ -132,34 +285,17 @@ namespace Kiaak
         model = glm::translate(model, position);
         model = glm::scale(model, glm::vec3(size, 1.0f));
 
-        // Get view-projection matrix from active camera
-        glm::mat4 VP(1.0f);
-        if (auto *cam = Core::Camera::GetActive())
-        {
-            VP = cam->GetViewProjection();
-        }
-        else
-        {
-            // Fallback to screen-space ortho
-            GLint vp[4];
-            glGetIntegerv(GL_VIEWPORT, vp);
-            float w = static_cast<float>(vp[2]);
-            float h = static_cast<float>(vp[3]);
-            VP = glm::ortho(-w * 0.5f, w * 0.5f, -h * 0.5f, h * 0.5f, -1.0f, 1.0f);
-        }
-
-        // Set uniforms
-        m_quadShader->SetMat4("transform", VP * model);
-        m_quadShader->SetVec4("color", color);
+        // View-projection comes from the per-frame camera block
+        m_quadShader->Set(m_quadModel, model);
+        m_quadShader->Set(m_quadColor, color);
 
         // Bind white texture
         m_whiteTexture->Bind(0);
-        m_quadShader->SetInt("ourTexture", 0);
+        m_quadShader->Set(m_quadTexture, 0);
 
         // Render quad
         m_quadVAO->Bind();
         glDrawArrays(GL_TRIANGLES, 0, 6);
-        m_quadVAO->Unbind();
     }
 
     void Renderer::InitializeQuadRenderer()
@@ -169,13 +305,19 @@ namespace Kiaak
         #version 330 core
         layout (location = 0) in vec2 aPos;
         layout (location = 1) in vec2 aTexCoord;
-        
-        uniform mat4 transform;
+
+        layout (std140) uniform Camera {
+            mat4 uView;
+            mat4 uProjection;
+            mat4 uViewProjection;
+            vec4 uViewportTime;
+        };
+        uniform mat4 uModel;
         
         out vec2 TexCoord;
         
         void main() {
-            gl_Position = transform * vec4(aPos, 0.0, 1.0);
+            gl_Position = uViewProjection * uModel * vec4(aPos, 0.0, 1.0);
             TexCoord = aTexCoord;
         }
     )";
@@ -204,6 +346,9 @@ namespace Kiaak
                 m_quadShader.reset();
                 return;
             }
+            m_quadModel = m_quadShader->GetUniformHandle("uModel");
+            m_quadColor = m_quadShader->GetUniformHandle("color");
+            m_quadTexture = m_quadShader->GetUniformHandle("ourTexture");
         }
         catch (const std::exception &e)
         {
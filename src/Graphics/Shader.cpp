@@ -1,8 +1,11 @@
 #include "Graphics/Shader.hpp"
+#include "Graphics/RenderState.hpp"
+#include "Graphics/UniformBuffer.hpp"
 #include <glad/glad.h>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <cstring>
 #include <GLFW/glfw3.h>
 
 namespace Kiaak {
@@ -17,6 +20,7 @@ Shader::Shader() : programID(0), isCompiled(false) {
 
 Shader::~Shader() {
     if (programID != 0) {
+        RenderState::OnDeleteProgram(programID);
         glDeleteProgram(programID);
     }
 }
@@ -68,6 +72,7 @@ bool Shader::LoadFromFile(const std::string& vertexPath, const std::string& frag
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    ReflectUniforms();
     isCompiled = true;
     return true;
 }
@@ -97,6 +102,7 @@ bool Shader::LoadFromString(const std::string& vertexSource, const std::string&
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    ReflectUniforms();
     isCompiled = true;
     std::cout << "Shader loaded successfully from string!" << std::endl;
     return true;
@@ -104,7 +110,7 @@ bool Shader::LoadFromString(const std::string& vertexSource, const std::string&
 
 void Shader::Use() {
     if (isCompiled) {
-        glUseProgram(programID);
+        RenderState::UseProgram(programID);
     }
 }
 
@@ -143,37 +149,138 @@ bool Shader::CheckProgramErrors(unsigned int program) {
     return true;
 }
 
+void Shader::ReflectUniforms() {
+    uniforms.clear();
+    uniformIndex.clear();
+
+    int count = 0;
+    glGetProgramiv(programID, GL_ACTIVE_UNIFORMS, &count);
+    int maxLen = 0;
+    glGetProgramiv(programID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLen);
+    std::vector<char> nameBuf(maxLen > 0 ? maxLen : 1);
+
+    for (int i = 0; i < count; ++i) {
+        GLint size = 0;
+        GLenum type = 0;
+        GLsizei len = 0;
+        glGetActiveUniform(programID, (GLuint)i, (GLsizei)nameBuf.size(), &len, &size, &type, nameBuf.data());
+        Uniform u;
+        u.name.assign(nameBuf.data(), len);
+        u.location = glGetUniformLocation(programID, u.name.c_str());
+        if (u.location < 0)
+            continue; // uniform block members have no location
+        u.type = type;
+        u.size = size;
+
+        int index = (int)uniforms.size();
+        uniformIndex[u.name] = index;
+        // "arr[0]" is also reachable as "arr"
+        size_t bracket = u.name.find('[');
+        if (bracket != std::string::npos)
+            uniformIndex.emplace(u.name.substr(0, bracket), index);
+        uniforms.push_back(std::move(u));
+    }
+
+    // GLSL 330 has no layout(binding) for blocks, so wire the shared ones up here
+    usesCameraBlock = false;
+    GLuint cameraBlock = glGetUniformBlockIndex(programID, "Camera");
+    if (cameraBlock != GL_INVALID_INDEX) {
+        glUniformBlockBinding(programID, cameraBlock, kCameraBlockBinding);
+        usesCameraBlock = true;
+    }
+}
+
+UniformHandle Shader::GetUniformHandle(const std::string& name) const {
+    UniformHandle handle;
+    auto it = uniformIndex.find(name);
+    if (it != uniformIndex.end())
+        handle.index = it->second;
+    return handle;
+}
+
+unsigned char* Shader::BeginUpload(UniformHandle handle, const void* data, size_t size) {
+    if (!handle.IsValid() || handle.index >= (int)uniforms.size())
+        return nullptr;
+    Uniform& u = uniforms[handle.index];
+    if (u.cached && std::memcmp(u.value, data, size) == 0)
+        return nullptr;
+    // glUniform* targets the current program
+    Use();
+    std::memcpy(u.value, data, size);
+    u.cached = true;
+    return u.value;
+}
+
+void Shader::Set(UniformHandle handle, bool value) {
+    Set(handle, (int)value);
+}
+
+void Shader::Set(UniformHandle handle, int value) {
+    if (BeginUpload(handle, &value, sizeof(value)))
+        glUniform1i(uniforms[handle.index].location, value);
+}
+
+void Shader::Set(UniformHandle handle, float value) {
+    if (BeginUpload(handle, &value, sizeof(value)))
+        glUniform1f(uniforms[handle.index].location, value);
+}
+
+void Shader::Set(UniformHandle handle, const glm::vec2& value) {
+    if (BeginUpload(handle, &value[0], sizeof(float) * 2))
+        glUniform2fv(uniforms[handle.index].location, 1, &value[0]);
+}
+
+void Shader::Set(UniformHandle handle, const glm::vec3& value) {
+    if (BeginUpload(handle, &value[0], sizeof(float) * 3))
+        glUniform3fv(uniforms[handle.index].location, 1, &value[0]);
+}
+
+void Shader::Set(UniformHandle handle, const glm::vec4& value) {
+    if (BeginUpload(handle, &value[0], sizeof(float) * 4))
+        glUniform4fv(uniforms[handle.index].location, 1, &value[0]);
+}
+
+void Shader::Set(UniformHandle handle, const glm::mat3& value) {
+    if (BeginUpload(handle, &value[0][0], sizeof(float) * 9))
+        glUniformMatrix3fv(uniforms[handle.index].location, 1, GL_FALSE, &value[0][0]);
+}
+
+void Shader::Set(UniformHandle handle, const glm::mat4& value) {
+    if (BeginUpload(handle, &value[0][0], sizeof(float) * 16))
+        glUniformMatrix4fv(uniforms[handle.index].location, 1, GL_FALSE, &value[0][0]);
+}
+
 // Uniform setters
 void Shader::SetBool(const std::string& name, bool value) {
-    glUniform1i(glGetUniformLocation(programID, name.c_str()), (int)value);
+    Set(GetUniformHandle(name), value);
 }
 
 void Shader::SetInt(const std::string& name, int value) {
-    glUniform1i(glGetUniformLocation(programID, name.c_str()), value);
+    Set(GetUniformHandle(name), value);
 }
 
 void Shader::SetFloat(const std::string& name, float value) {
-    glUniform1f(glGetUniformLocation(programID, name.c_str()), value);
+    Set(GetUniformHandle(name), value);
 }
 
 void Shader::SetVec2(const std::string& name, const glm::vec2& value) {
-    glUniform2fv(glGetUniformLocation(programID, name.c_str()), 1, &value[0]);
+    Set(GetUniformHandle(name), value);
 }
 
 void Shader::SetVec3(const std::string& name, const glm::vec3& value) {
-    glUniform3fv(glGetUniformLocation(programID, name.c_str()), 1, &value[0]);
+    Set(GetUniformHandle(name), value);
 }
 
 void Shader::SetVec4(const std::string& name, const glm::vec4& value) {
-    glUniform4fv(glGetUniformLocation(programID, name.c_str()), 1, &value[0]);
+    Set(GetUniformHandle(name), value);
 }
 
 void Shader::SetMat3(const std::string& name, const glm::mat3& value) {
-    glUniformMatrix3fv(glGetUniformLocation(programID, name.c_str()), 1, GL_FALSE, &value[0][0]);
+    Set(GetUniformHandle(name), value);
 }
 
 void Shader::SetMat4(const std::string& name, const glm::mat4& value) {
-    glUniformMatrix4fv(glGetUniformLocation(programID, name.c_str()), 1, GL_FALSE, &value[0][0]);
+    Set(GetUniformHandle(name), value);
 }
 
 } // namespace Kiaak
\ No newline at end of file
@@ -3,9 +3,15 @@
 #include "Core/Transform.hpp"
 #include "Core/Camera.hpp"
 #include "Core/Project.hpp"
+#include "Core/Scene.hpp"
+#include "Graphics/RenderState.hpp"
+#include "Graphics/Renderer.hpp"
+#include "Graphics/TextureCache.hpp"
 #include <glad/glad.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <iostream>
+#include <cmath>
+#include <cstring>
 
 namespace Kiaak
 {
@@ -13,8 +19,14 @@ namespace Kiaak
     {
 
         std::shared_ptr<Shader> SpriteRenderer::s_spriteShader = nullptr;
+        UniformHandle SpriteRenderer::s_uModel;
+        UniformHandle SpriteRenderer::s_uTransform;
+        UniformHandle SpriteRenderer::s_uTexture;
+        UniformHandle SpriteRenderer::s_uPremultiplied;
         std::shared_ptr<Texture> SpriteRenderer::s_defaultTexture = nullptr;
         int SpriteRenderer::s_rendererCount = 0;
+        std::unique_ptr<VertexArray> SpriteRenderer::s_streamVAO = nullptr;
+        unsigned int SpriteRenderer::s_streamVAOBuffer = 0;
 
         static constexpr float PPU = 100.0f;
 
@@ -42,17 +54,14 @@ namespace Kiaak
         {
             try
             {
-                m_texture = std::make_shared<Texture>(texturePath);
+                // Shared with every other user of the file; decoded off-thread on first
+                // use and the size is taken from the texture once it lands
+                m_texture = TextureCache::Get(texturePath);
+                if (!m_texture)
+                    std::cerr << "Texture not found: " << texturePath << std::endl;
                 m_texturePath = texturePath;
-                if (m_texture && m_size == glm::vec2(1.0f))
-                {
-                    // Convert pixel size to reasonable world units
-                    // Scale down by pixels per unit (like Unity's sprites)
-                    float pixelsPerUnit = 100.0f; // 100 pixels = 1 world unit
-                    float worldWidth = static_cast<float>(m_texture->GetWidth()) / pixelsPerUnit;
-                    float worldHeight = static_cast<float>(m_texture->GetHeight()) / pixelsPerUnit;
-                    m_size = glm::vec2(worldWidth, worldHeight);
-                }
+                m_sizeFromTexture = m_texture && m_size == glm::vec2(1.0f);
+                ApplyTextureSize();
             }
             catch (const std::exception &e)
             {
@@ -67,15 +76,49 @@ namespace Kiaak
             if (m_texture && m_size == glm::vec2(1.0f))
             {
                 m_size = glm::vec2(m_texture->GetWidth(), m_texture->GetHeight());
+                InvalidateBounds();
             }
         }
 
+        void SpriteRenderer::ApplyTextureSize()
+        {
+            if (!m_sizeFromTexture || !m_texture || m_texture->IsPending())
+                return;
+            m_sizeFromTexture = false;
+            if (!m_texture->IsValid())
+                return; // failed load keeps the default size
+            // Convert pixel size to reasonable world units
+            // Scale down by pixels per unit (like Unity's sprites)
+            float pixelsPerUnit = 100.0f; // 100 pixels = 1 world unit
+            float worldWidth = static_cast<float>(m_texture->GetWidth()) / pixelsPerUnit;
+            float worldHeight = static_cast<float>(m_texture->GetHeight()) / pixelsPerUnit;
+            m_size = glm::vec2(worldWidth, worldHeight);
+            InvalidateBounds();
+        }
+
+        void SpriteRenderer::SetSize(const glm::vec2 &size)
+        {
+            m_sizeFromTexture = false;
+            if (m_size == size)
+                return;
+            m_size = size;
+            InvalidateBounds();
+        }
+
+        void SpriteRenderer::InvalidateBounds()
+        {
+            auto *go = GetGameObject();
+            if (go && go->GetScene())
+                go->GetScene()->InvalidateBounds(go);
+        }
+
         void SpriteRenderer::SetUVRect(const glm::vec4 &uvRect)
         {
             if (m_uvRect == uvRect)
                 return;
             m_uvRect = uvRect;
-            UpdateQuadUVs();
+            m_uvDirty = true;
+            m_uvChanged = true;
         }
 
         void SpriteRenderer::Start()
@@ -85,6 +128,7 @@ namespace Kiaak
 
         void SpriteRenderer::Render()
         {
+            ApplyTextureSize();
             if (!m_visible || !s_spriteShader)
                 return;
 
@@ -94,44 +138,110 @@ namespace Kiaak
 
             s_spriteShader->Use();
 
-            // Build model matrix from Transform + explicit sprite size
-            glm::mat4 model(1.0f);
-            const glm::vec3 pos = transform->GetPosition();
-            const glm::vec3 rot = transform->GetRotation();
-            const glm::vec3 scale = transform->GetScale();
-
-            model = glm::translate(model, pos);
-            model = glm::rotate(model, glm::radians(rot.z), glm::vec3(0.0f, 0.0f, 1.0f));
-            model = glm::scale(model, glm::vec3(m_size, 1.0f));
-            model = glm::scale(model, scale);
+            // Build model matrix from the world transform + explicit sprite size
+            const glm::mat4 model = glm::scale(transform->GetWorldMatrix(), glm::vec3(m_size, 1.0f));
 
-            // If we have an active camera, use its VP; otherwise use screen-space ortho
-            glm::mat4 VP(1.0f);
-            if (auto *cam = Core::Camera::GetActive())
+            if (s_uModel.IsValid())
             {
-                VP = cam->GetViewProjection();
+                // View-projection comes from the per-frame camera block
+                s_spriteShader->Set(s_uModel, model);
             }
             else
             {
-                GLint vp[4];
-                glGetIntegerv(GL_VIEWPORT, vp);
-                float w = static_cast<float>(vp[2]);
-                float h = static_cast<float>(vp[3]);
-                VP = glm::ortho(-w * 0.5f, w * 0.5f, -h * 0.5f, h * 0.5f, -1.0f, 1.0f);
+                // Older project shaders still take a combined "transform"
+                glm::mat4 VP(1.0f);
+                if (auto *cam = Core::Camera::GetActive())
+                {
+                    VP = cam->GetViewProjection();
+                }
+                else
+                {
+                    float w = static_cast<float>(RenderState::GetViewportWidth());
+                    float h = static_cast<float>(RenderState::GetViewportHeight());
+                    VP = glm::ortho(-w * 0.5f, w * 0.5f, -h * 0.5f, h * 0.5f, -1.0f, 1.0f);
+                }
+                s_spriteShader->Set(s_uTransform, VP * model);
             }
 
-            s_spriteShader->SetMat4("transform", VP * model);
-
             auto textureToUse = m_texture ? m_texture : s_defaultTexture;
             if (textureToUse)
             {
                 textureToUse->Bind(0);
-                s_spriteShader->SetInt("ourTexture", 0);
+                s_spriteShader->Set(s_uTexture, 0);
+                s_spriteShader->Set(s_uPremultiplied, textureToUse->IsPremultiplied());
+            }
+
+            // A rect that changed since the last draw (animation) is streamed; once it
+            // holds for a frame it goes into this sprite's own quad and is drawn from there
+            if (m_uvChanged)
+            {
+                m_uvChanged = false;
+                if (DrawStreamed())
+                    return;
             }
 
+            if (m_uvDirty)
+                UpdateQuadUVs();
             m_vertexArray->Bind();
             glDrawArrays(GL_TRIANGLES, 0, 6);
-            m_vertexArray->Unbind();
+        }
+
+        bool SpriteRenderer::DrawStreamed()
+        {
+            StreamBuffer *stream = Renderer::GetVertexStream();
+            if (!stream)
+                return false;
+
+            const unsigned int stride = 4 * sizeof(float);
+            unsigned int offset = 0;
+            auto *dst = static_cast<float *>(stream->Allocate(6 * stride, stride, offset));
+            if (!dst)
+                return false;
+            const float u0 = m_uvRect.x, v0 = m_uvRect.y, u1 = m_uvRect.z, v1 = m_uvRect.w;
+            const float vertices[] = {
+                -0.5f, -0.5f, u0, v0,
+                0.5f, -0.5f, u1, v0,
+                0.5f, 0.5f, u1, v1,
+
+                -0.5f, -0.5f, u0, v0,
+                0.5f, 0.5f, u1, v1,
+                -0.5f, 0.5f, u0, v1};
+            std::memcpy(dst, vertices, sizeof(vertices));
+            stream->Commit();
+
+            if (!s_streamVAO || s_streamVAOBuffer != stream->GetID())
+            {
+                s_streamVAO = std::make_unique<VertexArray>();
+                s_streamVAO->Bind();
+                RenderState::BindBuffer(GL_ARRAY_BUFFER, stream->GetID());
+                glEnableVertexAttribArray(0);
+                glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void *)0);
+                glEnableVertexAttribArray(1);
+                glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void *)(2 * sizeof(float)));
+                s_streamVAOBuffer = stream->GetID();
+            }
+            s_streamVAO->Bind();
+            glDrawArrays(GL_TRIANGLES, (GLint)(offset / stride), 6);
+            return true;
+        }
+
+        void SpriteRenderer::GetWorldAABB(glm::vec2 &outMin, glm::vec2 &outMax) const
+        {
+            const auto *transform = GetGameObject()->GetTransform();
+            if (!transform)
+            {
+                outMin = outMax = glm::vec2(0.0f);
+                return;
+            }
+            // Extent of the transformed box: |M| * half, with M the world affine's linear part
+            // (covers rotation, scale and anything inherited from parents)
+            const Core::Affine2D &world = transform->GetWorldAffine();
+            const glm::vec2 half = 0.5f * m_size;
+            const glm::vec2 ext(std::fabs(world.cols[0].x) * std::fabs(half.x) + std::fabs(world.cols[1].x) * std::fabs(half.y),
+                                std::fabs(world.cols[0].y) * std::fabs(half.x) + std::fabs(world.cols[1].y) * std::fabs(half.y));
+            const glm::vec2 pos = world.cols[2];
+            outMin = pos - ext;
+            outMax = pos + ext;
         }
 
         void SpriteRenderer::CreateQuad()
@@ -180,8 +290,8 @@ namespace Kiaak
                 -0.5f, -0.5f, u0, v0,
                 0.5f, 0.5f, u1, v1,
                 -0.5f, 0.5f, u0, v1};
-            m_vertexBuffer->Bind();
             m_vertexBuffer->SetData(vertices, sizeof(vertices));
+            m_uvDirty = false;
         }
 
         void SpriteRenderer::InitializeShader()
@@ -207,7 +317,12 @@ namespace Kiaak
                 {
                     std::cerr << "Failed to load sprite shader files from " << vertPath << " and " << fragPath << "\n";
                     s_spriteShader = nullptr;
+                    return;
                 }
+                s_uModel = s_spriteShader->UsesCameraBlock() ? s_spriteShader->GetUniformHandle("uModel") : UniformHandle{};
+                s_uTransform = s_spriteShader->GetUniformHandle("transform");
+                s_uTexture = s_spriteShader->GetUniformHandle("ourTexture");
+                s_uPremultiplied = s_spriteShader->GetUniformHandle("uPremultiplied"); // absent in older project shaders
             }
             catch (const std::exception &e)
             {
@@ -219,7 +334,11 @@ namespace Kiaak
         void SpriteRenderer::CleanupShader()
         {
             if (s_rendererCount == 0)
+            {
                 s_spriteShader.reset();
+                s_streamVAO.reset();
+                s_streamVAOBuffer = 0;
+            }
         }
 
         void SpriteRenderer::CreateDefaultTexture()
@@ -0,0 +1,246 @@
+#include "Graphics/StaticLayer.hpp"
+#include "Graphics/Framebuffer.hpp"
+#include "Graphics/Renderer.hpp"
+#include "Graphics/RenderState.hpp"
+#include "Graphics/VertexArray.hpp"
+#include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace Kiaak
+{
+    namespace Graphics
+    {
+
+        std::unique_ptr<Shader> StaticLayer::s_shader = nullptr;
+        std::unique_ptr<VertexArray> StaticLayer::s_vao = nullptr;
+        UniformHandle StaticLayer::s_uRect;
+        UniformHandle StaticLayer::s_uZ;
+        UniformHandle StaticLayer::s_uTex;
+
+        StaticLayer::StaticLayer(float z) : m_depth(z) {}
+        StaticLayer::~StaticLayer() = default;
+
+        bool StaticLayer::EnsureTargets(int width, int height)
+        {
+            if (m_width == width && m_height == height && m_targets[0] && m_targets[1])
+                return m_targets[0]->IsComplete() && m_targets[1]->IsComplete();
+
+            // Framebuffer creation leaves the default target bound
+            const GLuint prev = RenderState::GetFramebuffer();
+            for (auto &target : m_targets)
+            {
+                if (target)
+                    target->Resize(width, height);
+                else
+                    target = std::make_unique<Framebuffer>(width, height);
+                // Texels map 1:1 to screen pixels; filtering would only blur
+                RenderState::BindTexture(target->GetColorTexture());
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            }
+            RenderState::BindFramebuffer(prev);
+
+            m_width = width;
+            m_height = height;
+            m_valid = false;
+            return m_targets[0]->IsComplete() && m_targets[1]->IsComplete();
+        }
+
+        glm::vec2 StaticLayer::TexelToWorld(int x, int y) const
+        {
+            return glm::vec2(static_cast<float>(m_originX + x) * m_texelSize.x,
+                             static_cast<float>(m_originY + y) * m_texelSize.y);
+        }
+
+        bool StaticLayer::Update(const glm::vec2 &viewMin, const glm::vec2 &viewMax, int viewportWidth, int viewportHeight,
+                                 uint64_t contentHash, const DrawFn &draw)
+        {
+            m_lastRedraws = 0;
+            if (viewportWidth <= 0 || viewportHeight <= 0)
+                return false;
+            const glm::vec2 texel = (viewMax - viewMin) / glm::vec2(static_cast<float>(viewportWidth), static_cast<float>(viewportHeight));
+            if (texel.x <= 0.0f || texel.y <= 0.0f)
+                return false;
+
+            const int marginX = std::max(kMinMargin, viewportWidth / 4);
+            const int marginY = std::max(kMinMargin, viewportHeight / 4);
+            if (!EnsureTargets(viewportWidth + 2 * marginX, viewportHeight + 2 * marginY))
+                return false;
+
+            // Cache placement that centers the current view
+            const glm::vec2 center = (viewMin + viewMax) * 0.5f;
+            const int wantX = static_cast<int>(std::floor(center.x / texel.x)) - m_width / 2;
+            const int wantY = static_cast<int>(std::floor(center.y / texel.y)) - m_height / 2;
+
+            // Any zoom change alters the texel grid; tolerate float noise from the camera matrices
+            const bool sameGrid = std::abs(texel.x - m_texelSize.x) <= texel.x * 1e-4f &&
+                                  std::abs(texel.y - m_texelSize.y) <= texel.y * 1e-4f;
+            int dx = wantX - m_originX;
+            int dy = wantY - m_originY;
+            if (!m_valid || contentHash != m_hash || !sameGrid || std::abs(dx) >= m_width || std::abs(dy) >= m_height)
+            {
+                m_texelSize = texel;
+                m_originX = wantX;
+                m_originY = wantY;
+                m_hash = contentHash;
+                BeginDraw();
+                Redraw(0, 0, m_width, m_height, draw);
+                EndDraw();
+                m_valid = true;
+                return true;
+            }
+
+            // Still inside the cached area: nothing to do
+            const int vx0 = static_cast<int>(std::floor(viewMin.x / texel.x));
+            const int vy0 = static_cast<int>(std::floor(viewMin.y / texel.y));
+            const int vx1 = static_cast<int>(std::ceil(viewMax.x / texel.x));
+            const int vy1 = static_cast<int>(std::ceil(viewMax.y / texel.y));
+            if (vx0 >= m_originX && vy0 >= m_originY && vx1 <= m_originX + m_width && vy1 <= m_originY + m_height)
+                return true;
+
+            // Scrolled past the margin: keep the overlap, redraw the exposed strips
+            Shift(dx, dy);
+            m_originX = wantX;
+            m_originY = wantY;
+            BeginDraw();
+            if (dx > 0)
+                Redraw(m_width - dx, 0, m_width, m_height, draw);
+            else if (dx < 0)
+                Redraw(0, 0, -dx, m_height, draw);
+            if (dy > 0)
+                Redraw(0, m_height - dy, m_width, m_height, draw);
+            else if (dy < 0)
+                Redraw(0, 0, m_width, -dy, draw);
+            EndDraw();
+            return true;
+        }
+
+        void StaticLayer::Shift(int dx, int dy)
+        {
+            // Texel (x, y) of the old cache lands at (x - dx, y - dy) in the new one
+            const Framebuffer &src = *m_targets[m_current];
+            const Framebuffer &dst = *m_targets[m_current ^ 1];
+            const int sx0 = std::max(0, dx), sx1 = std::min(m_width, m_width + dx);
+            const int sy0 = std::max(0, dy), sy1 = std::min(m_height, m_height + dy);
+
+            // RenderState only tracks the combined binding; put it back by hand afterwards
+            const GLuint prev = RenderState::GetFramebuffer();
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, src.GetID());
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, dst.GetID());
+            glBlitFramebuffer(sx0, sy0, sx1, sy1, sx0 - dx, sy0 - dy, sx1 - dx, sy1 - dy, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+            glBindFramebuffer(GL_FRAMEBUFFER, prev);
+
+            m_current ^= 1;
+        }
+
+        void StaticLayer::BeginDraw()
+        {
+            m_prevFramebuffer = RenderState::GetFramebuffer();
+            RenderState::GetViewport(m_prevViewport);
+            RenderState::GetBlendFunc(m_prevBlend);
+            m_prevBlendEnabled = RenderState::IsBlendEnabled();
+
+            m_targets[m_current]->Bind();
+            RenderState::SetViewport(0, 0, m_width, m_height);
+            // Accumulate premultiplied color so the layer composites like the original draws
+            RenderState::SetBlend(true);
+            RenderState::SetBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+            const glm::vec2 mn = TexelToWorld(0, 0);
+            const glm::vec2 mx = TexelToWorld(m_width, m_height);
+            Renderer::OverrideCameraUniforms(glm::mat4(1.0f), glm::ortho(mn.x, mx.x, mn.y, mx.y, -1000.0f, 1000.0f), m_width, m_height);
+            glEnable(GL_SCISSOR_TEST);
+        }
+
+        void StaticLayer::EndDraw()
+        {
+            glDisable(GL_SCISSOR_TEST);
+            Renderer::RestoreCameraUniforms();
+            if (m_prevBlend[0] != 0)
+                RenderState::SetBlendFuncSeparate(m_prevBlend[0], m_prevBlend[1], m_prevBlend[2], m_prevBlend[3]);
+            RenderState::SetBlend(m_prevBlendEnabled);
+            RenderState::SetViewport(m_prevViewport[0], m_prevViewport[1], m_prevViewport[2], m_prevViewport[3]);
+            RenderState::BindFramebuffer(m_prevFramebuffer);
+        }
+
+        void StaticLayer::Redraw(int x0, int y0, int x1, int y1, const DrawFn &draw)
+        {
+            if (x1 <= x0 || y1 <= y0)
+                return;
+            glScissor(x0, y0, x1 - x0, y1 - y0);
+            glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            // One texel of slack so culling never drops content touching the strip edge
+            draw(TexelToWorld(x0 - 1, y0 - 1), TexelToWorld(x1 + 1, y1 + 1));
+            m_lastRedraws++;
+        }
+
+        bool StaticLayer::EnsureShader()
+        {
+            if (s_shader)
+                return true;
+
+            const char *vs = R"(#version 330 core
+layout(std140) uniform Camera { mat4 uView; mat4 uProjection; mat4 uViewProjection; vec4 uViewportTime; };
+uniform vec4 uRect; // world min.xy, max.xy
+uniform float uZ;
+out vec2 vUV;
+void main(){ vec2 c = vec2(gl_VertexID & 1, gl_VertexID >> 1); vUV = c; gl_Position = uViewProjection * vec4(mix(uRect.xy, uRect.zw, c), uZ, 1.0); })";
+            const char *fs = R"(#version 330 core
+in vec2 vUV; out vec4 FragColor; uniform sampler2D uTex; void main(){ FragColor = texture(uTex, vUV); })";
+            s_shader = std::make_unique<Shader>();
+            if (!s_shader->LoadFromString(vs, fs))
+            {
+                std::cerr << "Failed to create static layer shader" << std::endl;
+                s_shader.reset();
+                return false;
+            }
+            s_uRect = s_shader->GetUniformHandle("uRect");
+            s_uZ = s_shader->GetUniformHandle("uZ");
+            s_uTex = s_shader->GetUniformHandle("uTex");
+            s_vao = std::make_unique<VertexArray>();
+            return true;
+        }
+
+        void StaticLayer::Composite() const
+        {
+            if (!m_valid || !EnsureShader())
+                return;
+
+            const glm::vec2 mn = TexelToWorld(0, 0);
+            const glm::vec2 mx = TexelToWorld(m_width, m_height);
+
+            GLenum prevBlend[4];
+            RenderState::GetBlendFunc(prevBlend);
+            const bool depthEnabled = RenderState::IsDepthTestEnabled();
+            const bool depthMask = RenderState::IsDepthMaskEnabled();
+            RenderState::SetDepthTest(false);
+            RenderState::SetDepthMask(false);
+            RenderState::SetBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+            s_shader->Use();
+            s_shader->Set(s_uRect, glm::vec4(mn.x, mn.y, mx.x, mx.y));
+            s_shader->Set(s_uZ, m_depth);
+            RenderState::BindTexture(0, m_targets[m_current]->GetColorTexture());
+            s_shader->Set(s_uTex, 0);
+            s_vao->Bind();
+            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+            if (prevBlend[0] != 0)
+                RenderState::SetBlendFuncSeparate(prevBlend[0], prevBlend[1], prevBlend[2], prevBlend[3]);
+            RenderState::SetDepthMask(depthMask);
+            RenderState::SetDepthTest(depthEnabled);
+        }
+
+        void StaticLayer::Shutdown()
+        {
+            s_vao.reset();
+            s_shader.reset();
+        }
+
+    } // namespace Graphics
+} // namespace Kiaak
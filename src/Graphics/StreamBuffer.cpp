@@ -0,0 +1,199 @@
+#include "Graphics/StreamBuffer.hpp"
+#include "Graphics/RenderState.hpp"
+#include <GLFW/glfw3.h>
+#include <iostream>
+
+// GL 4.4 / ARB_buffer_storage; loaded at runtime since the loader targets 3.3
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+#define GL_MAP_COHERENT_BIT 0x0080
+#endif
+
+namespace Kiaak
+{
+
+    namespace
+    {
+        typedef void(APIENTRYP BufferStorageFn)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+
+        BufferStorageFn LoadBufferStorage()
+        {
+            if (!glfwExtensionSupported("GL_ARB_buffer_storage"))
+                return nullptr;
+            auto fn = reinterpret_cast<BufferStorageFn>(glfwGetProcAddress("glBufferStorage"));
+            if (!fn)
+                fn = reinterpret_cast<BufferStorageFn>(glfwGetProcAddress("glBufferStorageARB"));
+            return fn;
+        }
+
+        // Below this a map/unmap pair costs more than letting the driver copy the data
+        constexpr unsigned int kMaxSubDataWrite = 4096;
+
+        unsigned int AlignUp(unsigned int value, unsigned int alignment)
+        {
+            if (alignment <= 1)
+                return value;
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    StreamBuffer::StreamBuffer(GLenum target, unsigned int bytesPerFrame, unsigned int framesInFlight)
+        : m_target(target), m_regionSize(bytesPerFrame), m_regionCount(framesInFlight ? framesInFlight : 1)
+    {
+        const unsigned int total = m_regionSize * m_regionCount;
+        m_fences.assign(m_regionCount, nullptr);
+
+        glGenBuffers(1, &m_bufferID);
+        RenderState::BindBuffer(m_target, m_bufferID);
+
+        if (BufferStorageFn bufferStorage = LoadBufferStorage())
+        {
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            bufferStorage(m_target, total, nullptr, flags);
+            m_persistent = static_cast<unsigned char *>(glMapBufferRange(m_target, 0, total, flags));
+            if (m_persistent)
+                m_mode = Mode::Persistent;
+            else
+            {
+                // Immutable storage can't be respecified; start over with a fresh buffer
+                RenderState::OnDeleteBuffer(m_bufferID);
+                glDeleteBuffers(1, &m_bufferID);
+                glGenBuffers(1, &m_bufferID);
+                RenderState::BindBuffer(m_target, m_bufferID);
+            }
+        }
+
+        if (m_mode != Mode::Persistent)
+        {
+            glBufferData(m_target, total, nullptr, GL_STREAM_DRAW);
+            // Unsynchronized mapping is core in 3.0 but some drivers emulate it badly;
+            // probe once and fall back to orphaning if it fails
+            void *probe = glMapBufferRange(m_target, 0, 16, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+            if (probe)
+            {
+                glUnmapBuffer(m_target);
+                m_mode = Mode::Unsynchronized;
+                m_staging.resize(kMaxSubDataWrite);
+            }
+            else
+            {
+                m_mode = Mode::Orphan;
+                m_staging.resize(m_regionSize);
+            }
+        }
+
+        static const char *names[] = {"persistent", "unsynchronized", "orphan"};
+        std::cout << "Created StreamBuffer with ID: " << m_bufferID << " (" << total << " bytes, "
+                  << names[(int)m_mode] << ")" << std::endl;
+    }
+
+    StreamBuffer::~StreamBuffer()
+    {
+        for (GLsync &fence : m_fences)
+            if (fence)
+                glDeleteSync(fence);
+        if (m_persistent)
+        {
+            RenderState::BindBuffer(m_target, m_bufferID);
+            glUnmapBuffer(m_target);
+        }
+        RenderState::OnDeleteBuffer(m_bufferID);
+        glDeleteBuffers(1, &m_bufferID);
+    }
+
+    void *StreamBuffer::Allocate(unsigned int size, unsigned int alignment, unsigned int &outOffset)
+    {
+        const unsigned int offset = AlignUp(m_head, alignment);
+        if (size == 0 || offset + size > m_regionStart + m_regionSize)
+            return nullptr;
+        m_head = offset + size;
+        outOffset = offset;
+
+        switch (m_mode)
+        {
+        case Mode::Persistent:
+            return m_persistent + offset;
+        case Mode::Unsynchronized:
+            if (size <= kMaxSubDataWrite)
+            {
+                // e.g. a single sprite quad: glBufferSubData on Commit
+                m_pending = m_staging.data();
+                break;
+            }
+            RenderState::BindBuffer(m_target, m_bufferID);
+            m_pending = glMapBufferRange(m_target, offset, size,
+                                         GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+            m_pendingMapped = m_pending != nullptr;
+            break;
+        case Mode::Orphan:
+            m_pending = m_staging.data() + (offset - m_regionStart);
+            break;
+        }
+        m_pendingOffset = offset;
+        m_pendingSize = size;
+        return m_pending;
+    }
+
+    void StreamBuffer::Commit()
+    {
+        if (!m_pending)
+            return;
+        RenderState::BindBuffer(m_target, m_bufferID);
+        if (m_pendingMapped)
+            glUnmapBuffer(m_target);
+        else
+            glBufferSubData(m_target, m_pendingOffset, m_pendingSize, m_pending);
+        m_pending = nullptr;
+        m_pendingMapped = false;
+    }
+
+    void StreamBuffer::EndFrame()
+    {
+        Commit();
+        if (m_mode != Mode::Orphan)
+        {
+            if (m_fences[m_region])
+                glDeleteSync(m_fences[m_region]);
+            m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+
+        m_region = (m_region + 1) % m_regionCount;
+        m_regionStart = m_region * m_regionSize;
+        m_head = m_regionStart;
+
+        if (m_mode == Mode::Orphan)
+        {
+            // Back at the start: hand the old storage to the driver instead of waiting on it
+            if (m_region == 0)
+            {
+                RenderState::BindBuffer(m_target, m_bufferID);
+                glBufferData(m_target, m_regionSize * m_regionCount, nullptr, GL_STREAM_DRAW);
+            }
+        }
+        else
+        {
+            WaitForRegion(m_region);
+        }
+    }
+
+    void StreamBuffer::WaitForRegion(unsigned int region)
+    {
+        GLsync fence = m_fences[region];
+        if (!fence)
+            return;
+        // With N regions in flight this is normally already signaled
+        GLbitfield flags = 0;
+        for (;;)
+        {
+            GLenum result = glClientWaitSync(fence, flags, 1000000); // 1 ms
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+                break;
+            flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        }
+        glDeleteSync(fence);
+        m_fences[region] = nullptr;
+    }
+
+} // namespace Kiaak
@@ -1,4 +1,9 @@
 #include "Graphics/Texture.hpp"
+#include "Graphics/RenderState.hpp"
+#include "Graphics/TextureCook.hpp"
+#include "Graphics/TextureLoader.hpp"
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <unordered_set>
 
@@ -7,9 +12,43 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include "../../external/stb/stb_image.h"
 
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+namespace
+{
+    // BC3 isn't core GL; desktop drivers all expose it as an extension
+    bool SupportsBC3()
+    {
+        static int supported = -1;
+        if (supported < 0)
+        {
+            supported = 0;
+            GLint count = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+            for (GLint i = 0; i < count; ++i)
+            {
+                const char *name = reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+                if (name && std::strcmp(name, "GL_EXT_texture_compression_s3tc") == 0)
+                {
+                    supported = 1;
+                    break;
+                }
+            }
+        }
+        return supported == 1;
+    }
+}
+
 // Static members
 std::unordered_set<Texture *> Texture::s_allTextures{};
 Texture::FilterMode Texture::s_currentFilterMode = Texture::FilterMode::Linear;
+size_t Texture::s_memoryBudget = 0;
+size_t Texture::s_residentBytes = 0;
+uint64_t Texture::s_frame = 1;
+uint64_t Texture::s_evictionCount = 0;
+uint64_t Texture::s_reloadCount = 0;
 
 Texture::Texture()
     : m_textureID(0), m_width(0), m_height(0), m_channels(0)
@@ -30,6 +69,28 @@ Texture::~Texture()
     Cleanup();
 }
 
+bool Texture::DecodeFile(const std::string &filePath, std::vector<unsigned char> &outPixels,
+                         int &outWidth, int &outHeight, int &outChannels, std::string *error)
+{
+    // Decoded top row first; flipped by hand below because stbi's flip flag is
+    // process-wide and decodes also run on loader threads
+    unsigned char *data = stbi_load(filePath.c_str(), &outWidth, &outHeight, &outChannels, 0);
+    if (!data)
+    {
+        if (error)
+            *error = stbi_failure_reason() ? stbi_failure_reason() : "unknown error";
+        return false;
+    }
+
+    const size_t rowBytes = static_cast<size_t>(outWidth) * outChannels;
+    outPixels.resize(rowBytes * outHeight);
+    for (int y = 0; y < outHeight; ++y)
+        std::memcpy(outPixels.data() + rowBytes * (outHeight - 1 - y), data + rowBytes * y, rowBytes);
+
+    stbi_image_free(data);
+    return true;
+}
+
 bool Texture::LoadFromFile(const std::string &filePath)
 {
     // Clean up any existing texture
@@ -38,30 +99,40 @@ bool Texture::LoadFromFile(const std::string &filePath)
     // Store file path
     m_filePath = filePath;
 
-    // stb_image loads images with origin at top-left, but OpenGL expects bottom-left
-    // So we flip the image vertically during loading
-    stbi_set_flip_vertically_on_load(true);
+    // A cooked file next to the source uploads its mip chain without decoding
+    const std::string cookedPath = Kiaak::TextureCook::FindCooked(filePath);
+    if (!cookedPath.empty())
+    {
+        std::string error;
+        auto cooked = Kiaak::CookedTexture::Open(cookedPath, &error);
+        if (!cooked)
+            std::cerr << "Failed to open cooked texture: " << cookedPath << " - " << error << std::endl;
+        else if (UploadCooked(*cooked))
+        {
+            std::cout << "Loaded cooked texture: " << cookedPath << std::endl;
+            std::cout << "  Size: " << m_width << "x" << m_height << ", " << m_mipLevels << " levels" << std::endl;
+            return true;
+        }
+        // Fall back to the source image
+    }
 
-    // Load image data
-    unsigned char *data = stbi_load(filePath.c_str(), &m_width, &m_height, &m_channels, 0);
-    if (!data)
+    // Load image data (bottom row first, as OpenGL expects)
+    std::vector<unsigned char> pixels;
+    int width = 0, height = 0, channels = 0;
+    std::string error;
+    if (!DecodeFile(filePath, pixels, width, height, channels, &error))
     {
         std::cerr << "Failed to load texture: " << filePath << std::endl;
-        std::cerr << "STB Error: " << stbi_failure_reason() << std::endl;
+        std::cerr << "STB Error: " << error << std::endl;
         return false;
     }
 
     std::cout << "Loaded texture: " << filePath << std::endl;
-    std::cout << "  Size: " << m_width << "x" << m_height << std::endl;
-    std::cout << "  Channels: " << m_channels << std::endl;
+    std::cout << "  Size: " << width << "x" << height << std::endl;
+    std::cout << "  Channels: " << channels << std::endl;
 
     // Create texture from loaded data
-    bool success = CreateFromData(data, m_width, m_height, m_channels);
-
-    // Free image data (we've copied it to GPU memory)
-    stbi_image_free(data);
-
-    return success;
+    return CreateFromData(pixels.data(), width, height, channels);
 }
 
 bool Texture::CreateFromData(unsigned char *data, int width, int height, int channels)
@@ -71,6 +142,14 @@ bool Texture::CreateFromData(unsigned char *data, int width, int height, int cha
         std::cerr << "Invalid texture data provided" << std::endl;
         return false;
     }
+    return Upload(data, width, height, channels);
+}
+
+bool Texture::Upload(const void *pixels, int width, int height, int channels)
+{
+    // Storage being replaced no longer counts
+    s_residentBytes -= m_gpuBytes;
+    m_gpuBytes = 0;
 
     // Store texture properties
     m_width = width;
@@ -79,7 +158,7 @@ bool Texture::CreateFromData(unsigned char *data, int width, int height, int cha
 
     // Generate OpenGL texture object
     glGenTextures(1, &m_textureID);
-    glBindTexture(GL_TEXTURE_2D, m_textureID);
+    Kiaak::RenderState::BindTexture(m_textureID);
 
     // Determine OpenGL format based on number of channels
     GLenum format;
@@ -100,42 +179,177 @@ bool Texture::CreateFromData(unsigned char *data, int width, int height, int cha
         return false;
     }
 
-    // Upload texture data to GPU
-    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+    // Rows are tightly packed (RGB widths are not always a multiple of 4)
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    // Zoomed-out cameras sample a smaller level instead of aliasing the full image
+    glGenerateMipmap(GL_TEXTURE_2D);
+    m_premultiplied = false;
+    m_mipLevels = 1;
+    for (int w = width, h = height; w > 1 || h > 1; w = std::max(1, w / 2), h = std::max(1, h / 2))
+        m_mipLevels++;
 
     // Set texture parameters for good quality
     SetTextureParameters();
 
+    // Drivers store RGB8 padded to 4 bytes per texel
+    const int texelBytes = channels == 3 ? 4 : channels;
+    for (int level = 0, w = width, h = height; level < m_mipLevels; ++level, w = std::max(1, w / 2), h = std::max(1, h / 2))
+        m_gpuBytes += static_cast<size_t>(w) * h * texelBytes;
+    s_residentBytes += m_gpuBytes;
+    m_lastUseFrame = s_frame;
+
     // Unbind texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    Kiaak::RenderState::BindTexture(0u);
 
     std::cout << "Created OpenGL texture with ID: " << m_textureID << std::endl;
 
     return true;
 }
 
+bool Texture::UploadCooked(const Kiaak::CookedTexture &cooked)
+{
+    const bool compressed = cooked.GetFormat() == Kiaak::KTexFormat::BC3;
+    if (compressed && !SupportsBC3())
+    {
+        std::cerr << "BC3 textures are not supported by this GPU" << std::endl;
+        return false;
+    }
+
+    s_residentBytes -= m_gpuBytes;
+    m_gpuBytes = 0;
+    const auto &header = cooked.GetHeader();
+    m_width = static_cast<int>(header.width);
+    m_height = static_cast<int>(header.height);
+    m_channels = 4;
+    m_mipLevels = static_cast<int>(cooked.GetLevelCount());
+    m_premultiplied = cooked.IsPremultiplied();
+
+    glGenTextures(1, &m_textureID);
+    Kiaak::RenderState::BindTexture(m_textureID);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, m_mipLevels - 1);
+    for (uint32_t i = 0; i < cooked.GetLevelCount(); ++i)
+    {
+        const auto &level = cooked.GetLevel(i);
+        const GLsizei w = static_cast<GLsizei>(level.width);
+        const GLsizei h = static_cast<GLsizei>(level.height);
+        if (compressed)
+            glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, w, h, 0,
+                                   static_cast<GLsizei>(level.size), cooked.GetLevelData(i));
+        else
+            glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, cooked.GetLevelData(i));
+        m_gpuBytes += static_cast<size_t>(level.size);
+    }
+    SetTextureParameters();
+    Kiaak::RenderState::BindTexture(0u);
+
+    s_residentBytes += m_gpuBytes;
+    m_lastUseFrame = s_frame;
+    std::cout << "Created OpenGL texture with ID: " << m_textureID << std::endl;
+    return true;
+}
+
 void Texture::Bind(unsigned int slot) const
 {
+    // Reloads the pixels if the budget evicted them; the texture's contents don't change
+    const_cast<Texture *>(this)->EnsureResident();
     if (m_textureID == 0)
     {
+        // Still loading: draw with the loader's white placeholder
+        if (m_pending)
+        {
+            Kiaak::RenderState::BindTexture(slot, Kiaak::TextureLoader::GetPlaceholderID());
+            return;
+        }
         std::cerr << "Warning: Attempting to bind invalid texture" << std::endl;
         return;
     }
 
-    // Activate texture unit
-    glActiveTexture(GL_TEXTURE0 + slot);
+    // Activate the unit and bind (skipped if already bound there)
+    Kiaak::RenderState::BindTexture(slot, m_textureID);
+}
 
-    // Bind texture to the active unit
-    glBindTexture(GL_TEXTURE_2D, m_textureID);
+bool Texture::EnsureResident()
+{
+    m_lastUseFrame = s_frame;
+    if (!m_evicted)
+        return m_textureID != 0;
+
+    // Synchronous: binding a placeholder would flash large backgrounds white
+    m_evicted = false;
+    const std::string path = m_filePath;
+    if (!LoadFromFile(path))
+    {
+        std::cerr << "Failed to reload evicted texture: " << path << std::endl;
+        return false;
+    }
+    s_reloadCount++;
+    return true;
 }
 
-void Texture::Unbind(unsigned int slot)
+void Texture::Evict()
+{
+    if (m_textureID == 0)
+        return;
+    Kiaak::RenderState::OnDeleteTexture(m_textureID);
+    glDeleteTextures(1, &m_textureID);
+    m_textureID = 0;
+    s_residentBytes -= m_gpuBytes;
+    m_gpuBytes = 0;
+    m_evicted = true;
+    s_evictionCount++;
+}
+
+void Texture::SetMemoryBudget(size_t bytes)
 {
-    // Activate texture unit
-    glActiveTexture(GL_TEXTURE0 + slot);
+    s_memoryBudget = bytes;
+    if (bytes > 0)
+        std::cout << "Texture memory budget: " << bytes / (1024 * 1024) << " MB" << std::endl;
+}
+
+void Texture::BeginFrame()
+{
+    s_frame++;
+    if (s_memoryBudget == 0 || s_residentBytes <= s_memoryBudget)
+        return;
+
+    // Only textures that can be reloaded and weren't drawn last frame; evicting
+    // anything still on screen would just reload it again
+    std::vector<Texture *> candidates;
+    for (auto *tex : s_allTextures)
+    {
+        if (tex->m_textureID != 0 && !tex->m_filePath.empty() && tex->m_lastUseFrame + 1 < s_frame)
+            candidates.push_back(tex);
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const Texture *a, const Texture *b)
+              { return a->m_lastUseFrame < b->m_lastUseFrame; });
 
-    // Unbind any texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    size_t evicted = 0;
+    for (auto *tex : candidates)
+    {
+        if (s_residentBytes <= s_memoryBudget)
+            break;
+        tex->Evict();
+        evicted++;
+    }
+
+    static bool s_warned = false;
+    if (s_residentBytes > s_memoryBudget && !s_warned)
+    {
+        std::cerr << "Warning: textures in use exceed the memory budget ("
+                  << s_residentBytes / (1024 * 1024) << " MB of " << s_memoryBudget / (1024 * 1024) << " MB)" << std::endl;
+        s_warned = true;
+    }
+    if (evicted > 0)
+        std::cout << "Evicted " << evicted << " textures to stay within the memory budget" << std::endl;
+}
+
+void Texture::Unbind(unsigned int slot)
+{
+    // Unbind any texture from the unit
+    Kiaak::RenderState::BindTexture(slot, 0u);
 }
 
 void Texture::SetTextureParameters()
@@ -152,11 +366,17 @@ void Texture::Cleanup()
     if (m_textureID != 0)
     {
         std::cout << "Destroying texture with ID: " << m_textureID << std::endl;
+        Kiaak::RenderState::OnDeleteTexture(m_textureID);
         glDeleteTextures(1, &m_textureID);
         m_textureID = 0;
     }
+    s_residentBytes -= m_gpuBytes;
+    m_gpuBytes = 0;
+    m_evicted = false;
 
     m_width = 0;
+    m_mipLevels = 1;
+    m_premultiplied = false;
     m_height = 0;
     m_channels = 0;
     m_filePath.clear();
@@ -164,8 +384,11 @@ void Texture::Cleanup()
 
 void Texture::ApplyFilterParameters() const
 {
-    GLint filter = (s_currentFilterMode == FilterMode::Linear) ? GL_LINEAR : GL_NEAREST;
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    const bool linear = s_currentFilterMode == FilterMode::Linear;
+    GLint filter = linear ? GL_LINEAR : GL_NEAREST;
+    // Nearest keeps pixel art crisp within a level; mips still stop minified shimmer
+    GLint minFilter = m_mipLevels > 1 ? (linear ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST) : filter;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
 }
 
@@ -179,10 +402,10 @@ void Texture::SetGlobalFilterMode(FilterMode mode)
     {
         if (!tex || !tex->m_textureID)
             continue;
-        glBindTexture(GL_TEXTURE_2D, tex->m_textureID);
+        Kiaak::RenderState::BindTexture(tex->m_textureID);
         tex->ApplyFilterParameters();
     }
-    glBindTexture(GL_TEXTURE_2D, 0);
+    Kiaak::RenderState::BindTexture(0u);
 }
 
 Texture::FilterMode Texture::GetGlobalFilterMode()
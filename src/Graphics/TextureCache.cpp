@@ -0,0 +1,107 @@
+#include "Graphics/TextureCache.hpp"
+#include "Graphics/TextureLoader.hpp"
+#include "Core/Project.hpp"
+#include <iostream>
+
+namespace Kiaak
+{
+
+    std::unordered_map<std::string, TextureCache::Entry> TextureCache::s_entries;
+    uint64_t TextureCache::s_hits = 0;
+    uint64_t TextureCache::s_misses = 0;
+    uint64_t TextureCache::s_evictions = 0;
+
+    std::string TextureCache::ResolvePath(const std::string &path)
+    {
+        if (path.empty() || std::filesystem::exists(path))
+            return path;
+        std::string candidate = Core::Project::HasPath() ? Core::Project::GetAssetsPath() + "/" + path
+                                                         : std::string("assets/") + path;
+        if (std::filesystem::exists(candidate))
+            return candidate;
+        return path;
+    }
+
+    std::shared_ptr<Texture> TextureCache::Get(const std::string &path, bool async)
+    {
+        if (path.empty())
+            return nullptr;
+
+        const std::string resolved = ResolvePath(path);
+        std::error_code ec;
+        const auto mtime = std::filesystem::last_write_time(resolved, ec);
+        if (ec)
+            return nullptr; // missing file
+
+        // One key per file no matter how it was spelled
+        std::string key = std::filesystem::absolute(resolved, ec).lexically_normal().string();
+        if (ec)
+            key = resolved;
+
+        auto it = s_entries.find(key);
+        if (it != s_entries.end() && it->second.mtime == mtime)
+        {
+            s_hits++;
+            return it->second.texture;
+        }
+
+        s_misses++;
+        std::shared_ptr<Texture> texture;
+        if (async)
+        {
+            texture = TextureLoader::Load(resolved);
+        }
+        else
+        {
+            texture = std::make_shared<Texture>(resolved);
+            if (!texture->IsValid())
+                return nullptr;
+        }
+        // A changed file replaces the entry; old holders keep the previous texture
+        s_entries[key] = Entry{texture, mtime};
+        return texture;
+    }
+
+    size_t TextureCache::EvictUnused()
+    {
+        size_t evicted = 0;
+        for (auto it = s_entries.begin(); it != s_entries.end();)
+        {
+            if (it->second.texture.use_count() == 1)
+            {
+                it = s_entries.erase(it);
+                evicted++;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        s_evictions += evicted;
+        if (evicted > 0)
+            std::cout << "TextureCache: evicted " << evicted << " unused textures" << std::endl;
+        return evicted;
+    }
+
+    TextureCache::Stats TextureCache::GetStats()
+    {
+        Stats stats;
+        stats.entries = s_entries.size();
+        stats.hits = s_hits;
+        stats.misses = s_misses;
+        stats.evictions = s_evictions;
+        for (const auto &entry : s_entries)
+        {
+            if (entry.second.texture.use_count() > 1)
+                stats.referenced++;
+            stats.residentBytes += entry.second.texture->GetGpuBytes();
+        }
+        return stats;
+    }
+
+    void TextureCache::Clear()
+    {
+        s_entries.clear();
+    }
+
+} // namespace Kiaak
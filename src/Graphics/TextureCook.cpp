@@ -0,0 +1,454 @@
+#include "Graphics/TextureCook.hpp"
+#include "Graphics/Texture.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Kiaak
+{
+
+    namespace
+    {
+        constexpr size_t kLevelAlignment = 16;
+        constexpr uint32_t kMaxLevels = 32;
+
+        struct Image
+        {
+            int width = 0;
+            int height = 0;
+            std::vector<unsigned char> rgba;
+        };
+
+        // Any channel count -> RGBA8 with premultiplied color
+        Image ToPremultipliedRGBA(const std::vector<unsigned char> &pixels, int width, int height, int channels)
+        {
+            Image image;
+            image.width = width;
+            image.height = height;
+            image.rgba.resize(static_cast<size_t>(width) * height * 4);
+            const size_t count = static_cast<size_t>(width) * height;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const unsigned char *src = pixels.data() + i * channels;
+                unsigned char *dst = image.rgba.data() + i * 4;
+                unsigned char r, g, b, a;
+                if (channels <= 2)
+                {
+                    r = g = b = src[0];
+                    a = channels == 2 ? src[1] : 255;
+                }
+                else
+                {
+                    r = src[0];
+                    g = src[1];
+                    b = src[2];
+                    a = channels == 4 ? src[3] : 255;
+                }
+                dst[0] = static_cast<unsigned char>((r * a + 127) / 255);
+                dst[1] = static_cast<unsigned char>((g * a + 127) / 255);
+                dst[2] = static_cast<unsigned char>((b * a + 127) / 255);
+                dst[3] = a;
+            }
+            return image;
+        }
+
+        // 2x2 box filter; odd edges clamp. Correct on premultiplied data only.
+        Image Downsample(const Image &src)
+        {
+            Image dst;
+            dst.width = std::max(1, src.width / 2);
+            dst.height = std::max(1, src.height / 2);
+            dst.rgba.resize(static_cast<size_t>(dst.width) * dst.height * 4);
+            for (int y = 0; y < dst.height; ++y)
+            {
+                const int y0 = std::min(y * 2, src.height - 1);
+                const int y1 = std::min(y * 2 + 1, src.height - 1);
+                for (int x = 0; x < dst.width; ++x)
+                {
+                    const int x0 = std::min(x * 2, src.width - 1);
+                    const int x1 = std::min(x * 2 + 1, src.width - 1);
+                    for (int c = 0; c < 4; ++c)
+                    {
+                        const int sum = src.rgba[(static_cast<size_t>(y0) * src.width + x0) * 4 + c] +
+                                        src.rgba[(static_cast<size_t>(y0) * src.width + x1) * 4 + c] +
+                                        src.rgba[(static_cast<size_t>(y1) * src.width + x0) * 4 + c] +
+                                        src.rgba[(static_cast<size_t>(y1) * src.width + x1) * 4 + c];
+                        dst.rgba[(static_cast<size_t>(y) * dst.width + x) * 4 + c] = static_cast<unsigned char>((sum + 2) / 4);
+                    }
+                }
+            }
+            return dst;
+        }
+
+        uint16_t To565(int r, int g, int b)
+        {
+            return static_cast<uint16_t>(((r * 31 + 127) / 255) << 11 | ((g * 63 + 127) / 255) << 5 | ((b * 31 + 127) / 255));
+        }
+
+        void From565(uint16_t c, int out[3])
+        {
+            const int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+            out[0] = (r << 3) | (r >> 2);
+            out[1] = (g << 2) | (g >> 4);
+            out[2] = (b << 3) | (b >> 2);
+        }
+
+        // One 4x4 RGBA block -> 16 bytes of BC3 (DXT5). Bounding-box endpoints with
+        // nearest-palette indices: fast and good enough for sprites.
+        void EncodeBC3Block(const unsigned char texels[16][4], unsigned char out[16])
+        {
+            // Alpha: 8-value interpolated palette between max and min
+            int aMax = 0, aMin = 255;
+            for (int i = 0; i < 16; ++i)
+            {
+                aMax = std::max(aMax, static_cast<int>(texels[i][3]));
+                aMin = std::min(aMin, static_cast<int>(texels[i][3]));
+            }
+            out[0] = static_cast<unsigned char>(aMax);
+            out[1] = static_cast<unsigned char>(aMin);
+            uint64_t alphaBits = 0;
+            if (aMax > aMin)
+            {
+                int palette[8] = {aMax, aMin};
+                for (int i = 2; i < 8; ++i)
+                    palette[i] = ((8 - i) * aMax + (i - 1) * aMin) / 7;
+                for (int i = 0; i < 16; ++i)
+                {
+                    int best = 0, bestDist = 256;
+                    for (int p = 0; p < 8; ++p)
+                    {
+                        const int d = std::abs(palette[p] - texels[i][3]);
+                        if (d < bestDist)
+                        {
+                            bestDist = d;
+                            best = p;
+                        }
+                    }
+                    alphaBits |= static_cast<uint64_t>(best) << (3 * i);
+                }
+            }
+            for (int i = 0; i < 6; ++i)
+                out[2 + i] = static_cast<unsigned char>(alphaBits >> (8 * i));
+
+            // Color: always decoded in 4-color mode in BC3
+            int lo[3] = {255, 255, 255}, hi[3] = {0, 0, 0};
+            for (int i = 0; i < 16; ++i)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    lo[c] = std::min(lo[c], static_cast<int>(texels[i][c]));
+                    hi[c] = std::max(hi[c], static_cast<int>(texels[i][c]));
+                }
+            }
+            // Inset the box a little; the extremes are rarely worth an endpoint
+            for (int c = 0; c < 3; ++c)
+            {
+                const int inset = (hi[c] - lo[c]) / 16;
+                lo[c] += inset;
+                hi[c] -= inset;
+            }
+            uint16_t c0 = To565(hi[0], hi[1], hi[2]);
+            uint16_t c1 = To565(lo[0], lo[1], lo[2]);
+            uint32_t colorBits = 0;
+            if (c0 != c1)
+            {
+                if (c0 < c1)
+                    std::swap(c0, c1);
+                int e0[3], e1[3];
+                From565(c0, e0);
+                From565(c1, e1);
+                int palette[4][3];
+                for (int c = 0; c < 3; ++c)
+                {
+                    palette[0][c] = e0[c];
+                    palette[1][c] = e1[c];
+                    palette[2][c] = (2 * e0[c] + e1[c]) / 3;
+                    palette[3][c] = (e0[c] + 2 * e1[c]) / 3;
+                }
+                for (int i = 0; i < 16; ++i)
+                {
+                    int best = 0, bestDist = 1 << 30;
+                    for (int p = 0; p < 4; ++p)
+                    {
+                        int d = 0;
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            const int diff = palette[p][c] - texels[i][c];
+                            d += diff * diff;
+                        }
+                        if (d < bestDist)
+                        {
+                            bestDist = d;
+                            best = p;
+                        }
+                    }
+                    colorBits |= static_cast<uint32_t>(best) << (2 * i);
+                }
+            }
+            out[8] = static_cast<unsigned char>(c0);
+            out[9] = static_cast<unsigned char>(c0 >> 8);
+            out[10] = static_cast<unsigned char>(c1);
+            out[11] = static_cast<unsigned char>(c1 >> 8);
+            for (int i = 0; i < 4; ++i)
+                out[12 + i] = static_cast<unsigned char>(colorBits >> (8 * i));
+        }
+
+        std::vector<unsigned char> EncodeBC3(const Image &image)
+        {
+            const int blocksX = (image.width + 3) / 4;
+            const int blocksY = (image.height + 3) / 4;
+            std::vector<unsigned char> out(static_cast<size_t>(blocksX) * blocksY * 16);
+            unsigned char texels[16][4];
+            for (int by = 0; by < blocksY; ++by)
+            {
+                for (int bx = 0; bx < blocksX; ++bx)
+                {
+                    // Partial blocks at the edges repeat the last row/column
+                    for (int i = 0; i < 16; ++i)
+                    {
+                        const int x = std::min(bx * 4 + (i % 4), image.width - 1);
+                        const int y = std::min(by * 4 + (i / 4), image.height - 1);
+                        std::memcpy(texels[i], &image.rgba[(static_cast<size_t>(y) * image.width + x) * 4], 4);
+                    }
+                    EncodeBC3Block(texels, &out[(static_cast<size_t>(by) * blocksX + bx) * 16]);
+                }
+            }
+            return out;
+        }
+
+        bool IsSourceImage(const std::filesystem::path &path)
+        {
+            std::string ext = path.extension().string();
+            std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c)
+                           { return static_cast<char>(std::tolower(c)); });
+            return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp" || ext == ".tga";
+        }
+    }
+
+    CookedTexture::~CookedTexture()
+    {
+#if !defined(_WIN32)
+        if (m_mapped)
+            munmap(const_cast<unsigned char *>(m_data), m_size);
+#endif
+    }
+
+    std::unique_ptr<CookedTexture> CookedTexture::Open(const std::string &path, std::string *error)
+    {
+        auto fail = [error](const char *reason) -> std::unique_ptr<CookedTexture>
+        {
+            if (error)
+                *error = reason;
+            return nullptr;
+        };
+
+        std::unique_ptr<CookedTexture> file(new CookedTexture());
+#if !defined(_WIN32)
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd >= 0)
+        {
+            struct stat st;
+            if (fstat(fd, &st) == 0 && st.st_size > 0)
+            {
+                void *p = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p != MAP_FAILED)
+                {
+                    file->m_data = static_cast<const unsigned char *>(p);
+                    file->m_size = static_cast<size_t>(st.st_size);
+                    file->m_mapped = true;
+                }
+            }
+            close(fd);
+        }
+#endif
+        if (!file->m_data)
+        {
+            std::ifstream in(path, std::ios::binary | std::ios::ate);
+            if (!in)
+                return fail("cannot open file");
+            file->m_buffer.resize(static_cast<size_t>(in.tellg()));
+            in.seekg(0);
+            if (!in.read(reinterpret_cast<char *>(file->m_buffer.data()), static_cast<std::streamsize>(file->m_buffer.size())))
+                return fail("read failed");
+            file->m_data = file->m_buffer.data();
+            file->m_size = file->m_buffer.size();
+        }
+
+        if (file->m_size < sizeof(KTexHeader))
+            return fail("file too small");
+        file->m_header = reinterpret_cast<const KTexHeader *>(file->m_data);
+        const KTexHeader &header = *file->m_header;
+        if (std::memcmp(header.magic, "KTEX", 4) != 0)
+            return fail("not a .ktex file");
+        if (header.version != kKTexVersion)
+            return fail("unsupported .ktex version");
+        if (header.format > static_cast<uint32_t>(KTexFormat::BC3))
+            return fail("unknown pixel format");
+        if (header.levels == 0 || header.levels > kMaxLevels || header.width == 0 || header.height == 0)
+            return fail("bad dimensions");
+        if (file->m_size < sizeof(KTexHeader) + header.levels * sizeof(KTexLevel))
+            return fail("truncated level table");
+        file->m_levels = reinterpret_cast<const KTexLevel *>(file->m_data + sizeof(KTexHeader));
+        // Uploads read width x height worth of data from each level whatever its size field says,
+        // so the dimensions must follow the header's mip chain and the size must match them
+        const bool compressed = header.format == static_cast<uint32_t>(KTexFormat::BC3);
+        uint32_t expectedWidth = header.width, expectedHeight = header.height;
+        for (uint32_t i = 0; i < header.levels; ++i)
+        {
+            const KTexLevel &level = file->m_levels[i];
+            if (i > 0 && file->m_levels[i - 1].width == 1 && file->m_levels[i - 1].height == 1)
+                return fail("levels past 1x1");
+            if (level.width != expectedWidth || level.height != expectedHeight)
+                return fail("level dimensions do not follow the mip chain");
+            const uint64_t expectedSize = compressed
+                                              ? uint64_t((level.width + 3) / 4) * ((level.height + 3) / 4) * 16
+                                              : uint64_t(level.width) * level.height * 4;
+            if (level.size != expectedSize)
+                return fail("level size does not match its dimensions");
+            if (level.offset > file->m_size || level.size > file->m_size - level.offset)
+                return fail("truncated level data");
+            expectedWidth = std::max(1u, expectedWidth / 2);
+            expectedHeight = std::max(1u, expectedHeight / 2);
+        }
+        return file;
+    }
+
+    size_t CookedTexture::GetDataSize() const
+    {
+        size_t total = 0;
+        for (uint32_t i = 0; i < m_header->levels; ++i)
+            total += static_cast<size_t>(m_levels[i].size);
+        return total;
+    }
+
+    bool TextureCook::CookFile(const std::string &sourcePath, const std::string &cookedPath, const Options &options)
+    {
+        std::vector<unsigned char> pixels;
+        int width = 0, height = 0, channels = 0;
+        std::string error;
+        if (!Texture::DecodeFile(sourcePath, pixels, width, height, channels, &error))
+        {
+            std::cerr << "Failed to cook texture: " << sourcePath << " - " << error << std::endl;
+            return false;
+        }
+
+        // Full chain down to 1x1
+        std::vector<Image> levels;
+        levels.push_back(ToPremultipliedRGBA(pixels, width, height, channels));
+        while (levels.back().width > 1 || levels.back().height > 1)
+            levels.push_back(Downsample(levels.back()));
+
+        std::vector<std::vector<unsigned char>> data;
+        for (const auto &level : levels)
+            data.push_back(options.compress ? EncodeBC3(level) : level.rgba);
+
+        KTexHeader header{};
+        std::memcpy(header.magic, "KTEX", 4);
+        header.version = kKTexVersion;
+        header.format = static_cast<uint32_t>(options.compress ? KTexFormat::BC3 : KTexFormat::RGBA8);
+        header.width = static_cast<uint32_t>(width);
+        header.height = static_cast<uint32_t>(height);
+        header.levels = static_cast<uint32_t>(levels.size());
+        header.flags = kKTexPremultiplied;
+
+        std::vector<KTexLevel> table(levels.size());
+        uint64_t offset = sizeof(KTexHeader) + table.size() * sizeof(KTexLevel);
+        for (size_t i = 0; i < levels.size(); ++i)
+        {
+            offset = (offset + kLevelAlignment - 1) / kLevelAlignment * kLevelAlignment;
+            table[i] = {static_cast<uint32_t>(levels[i].width), static_cast<uint32_t>(levels[i].height), offset, data[i].size()};
+            offset += data[i].size();
+        }
+
+        std::ofstream out(cookedPath, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            std::cerr << "Failed to write cooked texture: " << cookedPath << std::endl;
+            return false;
+        }
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char *>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(KTexLevel)));
+        const char padding[kLevelAlignment] = {};
+        uint64_t written = sizeof(KTexHeader) + table.size() * sizeof(KTexLevel);
+        for (size_t i = 0; i < levels.size(); ++i)
+        {
+            out.write(padding, static_cast<std::streamsize>(table[i].offset - written));
+            out.write(reinterpret_cast<const char *>(data[i].data()), static_cast<std::streamsize>(data[i].size()));
+            written = table[i].offset + data[i].size();
+        }
+        if (!out)
+        {
+            std::cerr << "Failed to write cooked texture: " << cookedPath << std::endl;
+            return false;
+        }
+
+        std::cout << "Cooked texture: " << sourcePath << " -> " << cookedPath << " (" << width << "x" << height << ", "
+                  << levels.size() << " levels" << (options.compress ? ", BC3" : "") << ", " << written / 1024 << " KB)" << std::endl;
+        return true;
+    }
+
+    int TextureCook::CookDirectory(const std::string &directory, const Options &options)
+    {
+        std::error_code ec;
+        if (!std::filesystem::is_directory(directory, ec))
+        {
+            std::cerr << "Cannot cook textures: " << directory << " is not a directory" << std::endl;
+            return -1;
+        }
+
+        int cooked = 0, failed = 0, upToDate = 0;
+        for (auto it = std::filesystem::recursive_directory_iterator(directory, ec);
+             !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+        {
+            if (!it->is_regular_file() || !IsSourceImage(it->path()))
+                continue;
+            const std::string source = it->path().string();
+            if (!options.force && !FindCooked(source).empty())
+            {
+                upToDate++;
+                continue;
+            }
+            if (CookFile(source, GetCookedPath(source), options))
+                cooked++;
+            else
+                failed++;
+        }
+        std::cout << "Texture cook: " << cooked << " written, " << upToDate << " up to date, " << failed << " failed" << std::endl;
+        return failed > 0 ? -1 : cooked;
+    }
+
+    std::string TextureCook::GetCookedPath(const std::string &sourcePath)
+    {
+        // Keep the source extension so player.png and player.jpg don't share a file
+        return sourcePath + ".ktex";
+    }
+
+    std::string TextureCook::FindCooked(const std::string &sourcePath)
+    {
+        std::error_code ec;
+        const std::filesystem::path source(sourcePath);
+        if (source.extension() == ".ktex")
+            return std::filesystem::exists(source, ec) ? sourcePath : std::string();
+
+        const std::string cooked = GetCookedPath(sourcePath);
+        const auto cookedTime = std::filesystem::last_write_time(cooked, ec);
+        if (ec)
+            return {};
+        // Stale once the source image is edited again
+        const auto sourceTime = std::filesystem::last_write_time(source, ec);
+        if (!ec && sourceTime > cookedTime)
+            return {};
+        return cooked;
+    }
+
+} // namespace Kiaak
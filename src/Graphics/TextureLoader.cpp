@@ -0,0 +1,200 @@
+#include "Graphics/TextureLoader.hpp"
+#include "Graphics/RenderState.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace Kiaak
+{
+
+    std::vector<std::thread> TextureLoader::s_workers;
+    std::mutex TextureLoader::s_mutex;
+    std::condition_variable TextureLoader::s_wake;
+    std::deque<TextureLoader::Job> TextureLoader::s_jobs;
+    std::deque<TextureLoader::Decoded> TextureLoader::s_done;
+    size_t TextureLoader::s_decoding = 0;
+    bool TextureLoader::s_stopping = false;
+
+    size_t TextureLoader::s_uploadBudget = 8u * 1024u * 1024u;
+    size_t TextureLoader::s_lastUploadBytes = 0;
+    GLuint TextureLoader::s_unpackBuffer = 0;
+    GLuint TextureLoader::s_placeholder = 0;
+
+    std::shared_ptr<Texture> TextureLoader::Load(const std::string &filePath)
+    {
+        auto texture = std::make_shared<Texture>();
+        texture->m_filePath = filePath;
+        texture->m_pending = true;
+
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            if (s_workers.empty())
+                StartWorkers();
+            s_jobs.push_back({filePath, texture});
+        }
+        s_wake.notify_one();
+        return texture;
+    }
+
+    void TextureLoader::StartWorkers()
+    {
+        // Leave a core for the main thread; decoding is the only work here
+        const unsigned int hw = std::thread::hardware_concurrency();
+        const unsigned int count = std::max(1u, std::min(4u, hw > 1 ? hw - 1 : 1u));
+        s_stopping = false;
+        for (unsigned int i = 0; i < count; ++i)
+            s_workers.emplace_back(WorkerMain);
+        std::cout << "Started " << count << " texture decode threads" << std::endl;
+    }
+
+    void TextureLoader::WorkerMain()
+    {
+        for (;;)
+        {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(s_mutex);
+                s_wake.wait(lock, []
+                            { return s_stopping || !s_jobs.empty(); });
+                if (s_stopping)
+                    return;
+                job = std::move(s_jobs.front());
+                s_jobs.pop_front();
+                // Texture already dropped by its owner: nothing to do
+                if (job.target.expired())
+                    continue;
+                s_decoding++;
+            }
+
+            Decoded result;
+            result.path = job.path;
+            result.target = job.target;
+            const std::string cookedPath = TextureCook::FindCooked(job.path);
+            if (!cookedPath.empty())
+                result.cooked = CookedTexture::Open(cookedPath, &result.error);
+            result.ok = result.cooked ||
+                        Texture::DecodeFile(job.path, result.pixels, result.width, result.height, result.channels, &result.error);
+
+            std::lock_guard<std::mutex> lock(s_mutex);
+            s_decoding--;
+            s_done.push_back(std::move(result));
+        }
+    }
+
+    size_t TextureLoader::GetPendingCount()
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        return s_jobs.size() + s_decoding + s_done.size();
+    }
+
+    void TextureLoader::Update()
+    {
+        s_lastUploadBytes = 0;
+        for (;;)
+        {
+            Decoded image;
+            {
+                std::lock_guard<std::mutex> lock(s_mutex);
+                if (s_done.empty())
+                    break;
+                const size_t bytes = s_done.front().Bytes();
+                if (s_lastUploadBytes > 0 && s_lastUploadBytes + bytes > s_uploadBudget)
+                    break; // rest waits for the next frame
+                image = std::move(s_done.front());
+                s_done.pop_front();
+            }
+
+            auto texture = image.target.lock();
+            if (!texture)
+                continue;
+            texture->m_pending = false;
+            if (!image.ok)
+            {
+                std::cerr << "Failed to load texture: " << image.path << std::endl;
+                std::cerr << "STB Error: " << image.error << std::endl;
+                continue;
+            }
+            Upload(*texture, image);
+            s_lastUploadBytes += image.Bytes();
+        }
+    }
+
+    void TextureLoader::Upload(Texture &texture, const Decoded &image)
+    {
+        if (image.cooked)
+        {
+            // Levels are already GPU-ready; if the format isn't supported, decode the source here
+            if (!texture.UploadCooked(*image.cooked) && !texture.LoadFromFile(image.path))
+                return;
+            texture.m_filePath = image.path;
+            return;
+        }
+
+        if (!s_unpackBuffer)
+            glGenBuffers(1, &s_unpackBuffer);
+
+        // Orphan and refill the staging buffer; the driver copies it to the texture
+        // without a CPU-side stall on the previous upload
+        const GLsizeiptr size = static_cast<GLsizeiptr>(image.pixels.size());
+        RenderState::BindBuffer(GL_PIXEL_UNPACK_BUFFER, s_unpackBuffer);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        void *dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        bool staged = false;
+        if (dst)
+        {
+            std::memcpy(dst, image.pixels.data(), image.pixels.size());
+            staged = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+        }
+        if (staged)
+            texture.Upload(nullptr, image.width, image.height, image.channels); // offset 0 in the PBO
+        RenderState::BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        // Mapping can fail (e.g. out of memory); fall back to a client-memory upload
+        if (!staged)
+            texture.Upload(image.pixels.data(), image.width, image.height, image.channels);
+        texture.m_filePath = image.path; // Upload's failure path clears it
+    }
+
+    GLuint TextureLoader::GetPlaceholderID()
+    {
+        if (!s_placeholder)
+        {
+            const unsigned char white[] = {255, 255, 255, 255};
+            glGenTextures(1, &s_placeholder);
+            RenderState::BindTexture(s_placeholder);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        }
+        return s_placeholder;
+    }
+
+    void TextureLoader::Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            s_stopping = true;
+            s_jobs.clear();
+        }
+        s_wake.notify_all();
+        for (auto &worker : s_workers)
+            worker.join();
+        s_workers.clear();
+        s_done.clear();
+        s_decoding = 0;
+
+        if (s_unpackBuffer)
+        {
+            RenderState::OnDeleteBuffer(s_unpackBuffer);
+            glDeleteBuffers(1, &s_unpackBuffer);
+            s_unpackBuffer = 0;
+        }
+        if (s_placeholder)
+        {
+            RenderState::OnDeleteTexture(s_placeholder);
+            glDeleteTextures(1, &s_placeholder);
+            s_placeholder = 0;
+        }
+    }
+
+} // namespace Kiaak
@@ -0,0 +1,36 @@
+#include "Graphics/UniformBuffer.hpp"
+#include "Graphics/RenderState.hpp"
+#include <iostream>
+
+namespace Kiaak
+{
+
+    UniformBuffer::UniformBuffer(unsigned int size, unsigned int binding)
+        : m_bufferID(0), m_size(size), m_binding(binding)
+    {
+        glGenBuffers(1, &m_bufferID);
+        RenderState::BindBuffer(GL_UNIFORM_BUFFER, m_bufferID);
+        glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+
+        // Attach to its binding point once; shaders pick it up by block binding
+        RenderState::BindBufferBase(GL_UNIFORM_BUFFER, binding, m_bufferID);
+    }
+
+    UniformBuffer::~UniformBuffer()
+    {
+        RenderState::OnDeleteBuffer(m_bufferID);
+        glDeleteBuffers(1, &m_bufferID);
+    }
+
+    void UniformBuffer::SetData(const void *data, unsigned int size, unsigned int offset)
+    {
+        if (offset + size > m_size)
+        {
+            std::cerr << "UniformBuffer::SetData out of range (" << offset + size << " > " << m_size << ")" << std::endl;
+            return;
+        }
+        RenderState::BindBuffer(GL_UNIFORM_BUFFER, m_bufferID);
+        glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    }
+
+} // namespace Kiaak
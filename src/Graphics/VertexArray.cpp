@@ -1,4 +1,5 @@
 #include "Graphics/VertexArray.hpp"
+#include "Graphics/RenderState.hpp"
 #include <iostream>
 
 namespace Kiaak {
@@ -11,17 +12,18 @@ VertexArray::VertexArray() {
 
 VertexArray::~VertexArray() {
     std::cout << "Destroying VertexArray with ID: " << m_arrayID << std::endl;
+    RenderState::OnDeleteVertexArray(m_arrayID);
     glDeleteVertexArrays(1, &m_arrayID);
 }
 
 void VertexArray::Bind() const {
     // Bind this VAO as the active one
-    glBindVertexArray(m_arrayID);
+    RenderState::BindVertexArray(m_arrayID);
 }
 
 void VertexArray::Unbind() const {
     // Unbind by setting 0 as active VAO
-    glBindVertexArray(0);
+    RenderState::BindVertexArray(0);
 }
 
 void VertexArray::AddAttribute(unsigned int index, unsigned int count, unsigned int type, 
@@ -1,4 +1,5 @@
 #include "Graphics/VertexBuffer.hpp"
+#include "Graphics/RenderState.hpp"
 #include <iostream>
 
 namespace Kiaak
@@ -11,11 +12,12 @@ namespace Kiaak
         std::cout << "Created VertexBuffer with ID: " << m_bufferID << std::endl;
 
         // Bind this buffer as the active array buffer
-        glBindBuffer(GL_ARRAY_BUFFER, m_bufferID);
+        RenderState::BindBuffer(GL_ARRAY_BUFFER, m_bufferID);
 
         // Upload data to the GPU
         // GL_STATIC_DRAW means we set the data once and draw many times
         glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+        m_size = size;
 
         std::cout << "Uploaded " << size << " bytes to GPU" << std::endl;
     }
@@ -23,27 +25,35 @@ namespace Kiaak
     VertexBuffer::~VertexBuffer()
     {
         std::cout << "Destroying VertexBuffer with ID: " << m_bufferID << std::endl;
+        RenderState::OnDeleteBuffer(m_bufferID);
         glDeleteBuffers(1, &m_bufferID);
     }
 
     void VertexBuffer::Bind() const
     {
         // Tell OpenGL to use this buffer for array operations
-        glBindBuffer(GL_ARRAY_BUFFER, m_bufferID);
+        RenderState::BindBuffer(GL_ARRAY_BUFFER, m_bufferID);
     }
 
     void VertexBuffer::Unbind() const
     {
         // Unbind by setting 0 as the active buffer
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        RenderState::BindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
     void VertexBuffer::SetData(const void *data, unsigned int size)
     {
         // Bind first, then update data
         Bind();
-        glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
-        // buffer data updated
+        if (size <= m_size)
+        {
+            // Reuse the existing storage instead of reallocating it
+            glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+            return;
+        }
+        // Data that gets respecified is not static; hint the driver accordingly
+        glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+        m_size = size;
     }
 
 } // namespace Kiaak
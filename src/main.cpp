@@ -1,9 +1,77 @@
 #include "Engine.hpp"
+#include "Graphics/TextureCook.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+static void PrintUsage(const char *exe) {
+    std::cout << "Usage: " << exe << " [options]\n"
+              << "  --headless          render offscreen without a visible window\n"
+              << "  --frames N          exit after N frames\n"
+              << "  --capture FILE.ppm  save the last frame (headless only)\n"
+              << "  --size WxH          framebuffer size (default 800x600)\n"
+              << "  --project PATH      open this project instead of the last one\n"
+              << "  --scene NAME        start in this scene\n"
+              << "  --texture-budget MB evict least recently used textures above this\n"
+              << "  --cook DIR          write .ktex (mipmapped, premultiplied) next to every image in DIR and exit\n"
+              << "  --bc3               with --cook: BC3-compress the cooked textures\n"
+              << "  --force             with --cook: re-cook files that are up to date\n";
+}
+
+int main(int argc, char **argv) {
+    Kiaak::LaunchOptions options;
+    std::string cookDir;
+    Kiaak::TextureCook::Options cookOptions;
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--headless") == 0) {
+            options.headless = true;
+        } else if (std::strcmp(arg, "--frames") == 0 && hasValue) {
+            options.maxFrames = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--capture") == 0 && hasValue) {
+            options.capturePath = argv[++i];
+        } else if (std::strcmp(arg, "--size") == 0 && hasValue) {
+            int w = 0, h = 0;
+            if (std::sscanf(argv[++i], "%dx%d", &w, &h) == 2 && w > 0 && h > 0) {
+                options.width = w;
+                options.height = h;
+            }
+        } else if (std::strcmp(arg, "--project") == 0 && hasValue) {
+            options.projectPath = argv[++i];
+        } else if (std::strcmp(arg, "--scene") == 0 && hasValue) {
+            options.sceneName = argv[++i];
+        } else if (std::strcmp(arg, "--texture-budget") == 0 && hasValue) {
+            options.textureBudgetMB = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(arg, "--cook") == 0 && hasValue) {
+            cookDir = argv[++i];
+        } else if (std::strcmp(arg, "--bc3") == 0) {
+            cookOptions.compress = true;
+        } else if (std::strcmp(arg, "--force") == 0) {
+            cookOptions.force = true;
+        } else {
+            PrintUsage(argv[0]);
+            return std::strcmp(arg, "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    // Offline asset step: no window or GL context needed
+    if (!cookDir.empty())
+        return Kiaak::TextureCook::CookDirectory(cookDir, cookOptions) < 0 ? 1 : 0;
+
+    if (!options.capturePath.empty() && !options.headless) {
+        std::cerr << "--capture requires --headless" << std::endl;
+        return 1;
+    }
+    // A headless run with no frame limit would never exit
+    if (options.headless && options.maxFrames <= 0)
+        options.maxFrames = 1;
 
-int main() {
     Kiaak::Engine engine;
     
-    if (engine.Initialize()) {
+    if (engine.Initialize(options)) {
         engine.Run();
     }
     